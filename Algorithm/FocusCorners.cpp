@@ -25,16 +25,16 @@
 using namespace VieVS;
 using namespace std;
 
-bool VieVS::FocusCorners::flag = false;
-int VieVS::FocusCorners::nscans = 1;
-int thread_local VieVS::FocusCorners::iscan = 0;
-bool thread_local VieVS::FocusCorners::startFocusCorner = false;
-std::vector<double> thread_local VieVS::FocusCorners::lastCornerAzimuth = std::vector<double>();
-std::vector<std::pair<int, double>> thread_local VieVS::FocusCorners::backupWeight =
+thread_local SessionParameter<bool> VieVS::FocusCorners::flag = false;
+thread_local SessionParameter<int> VieVS::FocusCorners::nscans = 1;
+thread_local SessionParameter<int> VieVS::FocusCorners::iscan = 0;
+thread_local SessionParameter<bool> VieVS::FocusCorners::startFocusCorner = false;
+thread_local SessionParameter<std::vector<double>> VieVS::FocusCorners::lastCornerAzimuth = std::vector<double>();
+thread_local SessionParameter<std::vector<std::pair<int, double>>> VieVS::FocusCorners::backupWeight =
     std::vector<std::pair<int, double>>();
-unsigned int thread_local VieVS::FocusCorners::nextStart = numeric_limits<unsigned int>::max();
-unsigned int thread_local VieVS::FocusCorners::interval = 900;
-std::vector<int> thread_local VieVS::FocusCorners::staid2groupid = std::vector<int>();
+thread_local SessionParameter<unsigned int> VieVS::FocusCorners::nextStart = numeric_limits<unsigned int>::max();
+thread_local SessionParameter<unsigned int> VieVS::FocusCorners::interval = 900;
+thread_local SessionParameter<std::vector<int>> VieVS::FocusCorners::staid2groupid = std::vector<int>();
 
 
 void VieVS::FocusCorners::initialize( const Network &network, ofstream &of ) {
@@ -73,11 +73,11 @@ void VieVS::FocusCorners::initialize( const Network &network, ofstream &of ) {
         const Station &sta = network.getStation( i );
         double dxy1 = getDxy( sta1, sta );
         if ( dxy1 < maxBl * 0.33 ) {
-            staid2groupid[i] = 1;
+            staid2groupid.edit()[i] = 1;
         }
         double dxy2 = getDxy( sta2, sta );
         if ( dxy2 < maxBl * 0.33 ) {
-            staid2groupid[i] = 2;
+            staid2groupid.edit()[i] = 2;
         }
     }
 
@@ -184,7 +184,7 @@ void VieVS::FocusCorners::reweight( const Subcon &subcon, SourceList &sourceList
 
     for ( int idx : bestElements ) {
         unsigned long srcid = scans[idx].getSourceId();
-        backupWeight.emplace_back( srcid, sourceList.getSource( srcid )->getPARA().weight );
+        backupWeight.edit().emplace_back( srcid, sourceList.getSource( srcid )->getPARA().weight );
         double newWeight = 1000 / ( sumEl[idx] / minimum );
         of << boost::format(
                   "|     increase weight of source %-8s to %7.2f                                             "
@@ -199,7 +199,7 @@ void FocusCorners::reset( const std::vector<Scan> &bestScans, SourceList &source
     for ( const auto &any : backupWeight ) {
         sourceList.refSource( any.first )->referencePARA().weight = any.second;
     }
-    backupWeight.clear();
+    backupWeight.edit().clear();
     FocusCorners::iscan = 0;
     FocusCorners::nextStart += FocusCorners::interval;
 
@@ -207,7 +207,7 @@ void FocusCorners::reset( const std::vector<Scan> &bestScans, SourceList &source
         for ( int i = 0; i < scan.getNSta(); ++i ) {
             const PointingVector &pv = scan.getPointingVector( i );
             unsigned long staid = pv.getStaid();
-            lastCornerAzimuth[staid] = pv.getAz();
+            lastCornerAzimuth.edit()[staid] = pv.getAz();
         }
     }
     FocusCorners::startFocusCorner = false;
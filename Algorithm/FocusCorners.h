@@ -27,6 +27,7 @@
 #ifndef FOCUSCORNERS_H
 #define FOCUSCORNERS_H
 
+#include "../Misc/SessionParameter.h"
 #include "../Scan/Subcon.h"
 
 namespace VieVS {
@@ -73,17 +74,21 @@ class FocusCorners {
      */
     static void reset( const std::vector<Scan> &bestScans, SourceList &sourceList );
 
-    static bool flag;                            ///< use focus corner algorithm
-    static thread_local int iscan;               ///< indedx of focus corner scans
-    static int nscans;                           ///< number of focus corner scans
-    static thread_local bool startFocusCorner;   ///< focus observation at corner
-    static thread_local unsigned int nextStart;  ///< next time when algorithm starts
-    static thread_local unsigned int interval;   ///< time intervall between algorithm
+    static thread_local SessionParameter<bool> flag;               ///< use focus corner algorithm
+    static thread_local SessionParameter<int> iscan;               ///< indedx of focus corner scans
+    static thread_local SessionParameter<int> nscans;              ///< number of focus corner scans
+    static thread_local SessionParameter<bool> startFocusCorner;   ///< focus observation at corner
+    static thread_local SessionParameter<unsigned int> nextStart;  ///< next time when algorithm starts
+    static thread_local SessionParameter<unsigned int> interval;   ///< time intervall between algorithm
 
    private:
-    static thread_local std::vector<double> lastCornerAzimuth;  ///< last observed azimuth (which corner was observed)
-    static thread_local std::vector<std::pair<int, double>> backupWeight;  ///< backup weights
-    static thread_local std::vector<int> staid2groupid;                    ///< station id to corner group id
+    friend class SchedulingContext;
+
+    /// last observed azimuth (which corner was observed)
+    static thread_local SessionParameter<std::vector<double>> lastCornerAzimuth;
+    static thread_local SessionParameter<std::vector<std::pair<int, double>>> backupWeight;  ///< backup weights
+    /// station id to corner group id
+    static thread_local SessionParameter<std::vector<int>> staid2groupid;
 
     /**
      * @brief find n lowest values
@@ -0,0 +1,203 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   LookupTableBenchmark.cpp
+ * Author: mschartn
+ *
+ * 17.10.2026
+ *
+ * micro benchmark of LookupTable::angularDistance
+ *
+ * Compares the flat angular distance table with the previous nested table (copied below) and with the exact
+ * spherical distance using acos. Accuracy is measured against the exact solution for random pairs of pointing
+ * vectors above the horizon.
+ *
+ * build: cmake -DBUILD_BENCHMARKS=ON -DCMAKE_BUILD_TYPE=Release
+ * usage: benchmark_lookup_table [number of pairs] (default: 1000000)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/format.hpp>
+
+#include "../Misc/Constants.h"
+#include "../Misc/LookupTable.h"
+
+using namespace std;
+using namespace VieVS;
+
+namespace {
+
+/**
+ * @brief previous implementation of the angular distance table (reference)
+ *
+ * one vector per start elevation and azimuth difference, bounds checked acos lookup
+ */
+class NestedLookupTable {
+   public:
+    NestedLookupTable() {
+        unsigned int maxEl = 91;
+        unsigned int sizeAz = 181;
+        for ( unsigned int thisEl = 0; thisEl < maxEl; ++thisEl ) {
+            unsigned int sizeEl = maxEl - thisEl;
+            double thisEl_rad = thisEl * deg2rad;
+
+            vector<vector<float>> thisStorage( sizeAz, vector<float>( sizeEl, 0 ) );
+
+            for ( unsigned int deltaAz = 0; deltaAz < sizeAz; ++deltaAz ) {
+                double deltaAz_rad = deltaAz * deg2rad;
+                for ( unsigned int deltaEl = 0; deltaEl < sizeEl; ++deltaEl ) {
+                    double deltaEl_rad = deltaEl * deg2rad;
+
+                    double tmp = LookupTable::sinLookup( thisEl_rad ) *
+                                     LookupTable::sinLookup( thisEl_rad + deltaEl_rad ) +
+                                 LookupTable::cosLookup( thisEl_rad ) *
+                                     LookupTable::cosLookup( thisEl_rad + deltaEl_rad ) *
+                                     LookupTable::cosLookup( deltaAz_rad );
+                    double angle = LookupTable::acosLookup( tmp );
+
+                    thisStorage[deltaAz][deltaEl] = static_cast<float>( angle );
+                }
+            }
+            angularDistanceLookup_.push_back( move( thisStorage ) );
+        }
+    }
+
+    float angularDistance( double phi1, double theta1, double phi2, double theta2 ) const noexcept {
+        if ( phi1 > phi2 ) {
+            swap( phi1, phi2 );
+        }
+        if ( theta1 > theta2 ) {
+            swap( theta1, theta2 );
+        }
+
+        double deltaPhi_tmp = ( phi2 - phi1 ) * rad2deg;
+        while ( deltaPhi_tmp > 180 ) {
+            deltaPhi_tmp = deltaPhi_tmp - 360;
+        }
+
+        long deltaPhi = abs( lround( deltaPhi_tmp ) );
+
+        auto thisTheta = lround( theta1 * rad2deg );
+        auto deltaTheta = lround( ( theta2 - theta1 ) * rad2deg );
+
+        return angularDistanceLookup_[thisTheta][deltaPhi][deltaTheta];
+    }
+
+   private:
+    vector<vector<vector<float>>> angularDistanceLookup_;
+};
+
+
+/**
+ * @brief exact angular distance
+ */
+double exactAngularDistance( double phi1, double theta1, double phi2, double theta2 ) {
+    double tmp = sin( theta1 ) * sin( theta2 ) + cos( theta1 ) * cos( theta2 ) * cos( phi2 - phi1 );
+    return acos( min( max( tmp, -1.0 ), 1.0 ) );
+}
+
+
+struct Pair {
+    double phi1;
+    double theta1;
+    double phi2;
+    double theta2;
+};
+
+
+/**
+ * @brief evaluate distance function for all pairs
+ *
+ * @return run time per call in nanoseconds, maximum and rms error w.r.t. the exact solution in degrees
+ */
+template <typename Function>
+vector<double> evaluate( const vector<Pair> &pairs, const vector<double> &exact, Function distance ) {
+    vector<double> result( pairs.size() );
+    auto start = chrono::steady_clock::now();
+    for ( unsigned long i = 0; i < pairs.size(); ++i ) {
+        const Pair &p = pairs[i];
+        result[i] = distance( p.phi1, p.theta1, p.phi2, p.theta2 );
+    }
+    auto finish = chrono::steady_clock::now();
+
+    double maxError = 0;
+    double sumError2 = 0;
+    for ( unsigned long i = 0; i < pairs.size(); ++i ) {
+        double error = abs( result[i] - exact[i] ) * rad2deg;
+        maxError = max( maxError, error );
+        sumError2 += error * error;
+    }
+    double ns = chrono::duration<double, nano>( finish - start ).count() / pairs.size();
+    return { ns, maxError, sqrt( sumError2 / pairs.size() ) };
+}
+
+}  // namespace
+
+
+int main( int argc, char *argv[] ) {
+    unsigned long n = argc > 1 ? stoul( argv[1] ) : 1000000;
+
+    LookupTable::initialize();
+    NestedLookupTable nested;
+
+    // random pairs of pointing vectors (azimuth in [0, 2pi), elevation in [0, pi/2])
+    mt19937_64 generator( 1 );
+    uniform_real_distribution<double> azDist( 0, twopi );
+    uniform_real_distribution<double> elDist( 0, halfpi );
+    vector<Pair> pairs( n );
+    for ( auto &p : pairs ) {
+        p = { azDist( generator ), elDist( generator ), azDist( generator ), elDist( generator ) };
+    }
+
+    vector<double> exact( n );
+    for ( unsigned long i = 0; i < n; ++i ) {
+        exact[i] = exactAngularDistance( pairs[i].phi1, pairs[i].theta1, pairs[i].phi2, pairs[i].theta2 );
+    }
+
+    unsigned long nDifferent = 0;
+    for ( const auto &p : pairs ) {
+        if ( nested.angularDistance( p.phi1, p.theta1, p.phi2, p.theta2 ) !=
+             LookupTable::angularDistance( p.phi1, p.theta1, p.phi2, p.theta2 ) ) {
+            ++nDifferent;
+        }
+    }
+
+    auto tExact = evaluate( pairs, exact, exactAngularDistance );
+    auto tNested = evaluate( pairs, exact, [&nested]( double phi1, double theta1, double phi2, double theta2 ) {
+        return nested.angularDistance( phi1, theta1, phi2, theta2 );
+    } );
+    auto tFlat = evaluate( pairs, exact, []( double phi1, double theta1, double phi2, double theta2 ) {
+        return LookupTable::angularDistance( phi1, theta1, phi2, theta2 );
+    } );
+
+    cout << boost::format( "angular distance of %d random pairs\n" ) % n;
+    cout << "                 ns/call   max error [deg]   rms error [deg]\n";
+    cout << boost::format( "exact acos    %10.2f %17.2e %17.2e\n" ) % tExact[0] % tExact[1] % tExact[2];
+    cout << boost::format( "nested table  %10.2f %17.2e %17.2e\n" ) % tNested[0] % tNested[1] % tNested[2];
+    cout << boost::format( "flat table    %10.2f %17.2e %17.2e\n" ) % tFlat[0] % tFlat[1] % tFlat[2];
+    cout << boost::format( "pairs where nested and flat table differ: %d\n" ) % nDifferent;
+    return 0;
+}
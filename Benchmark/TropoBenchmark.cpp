@@ -0,0 +1,238 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TropoBenchmark.cpp
+ * Author: mschartn
+ *
+ * 17.10.2026
+ *
+ * micro benchmark of the turbulence covariance used in Simulator::simTropo
+ *
+ * Compares the current implementation (TurbulenceCovariance) with the previous per pair implementation (copied
+ * below) for a synthetic 24h session of one station. The covariance blocks of all consecutive 2h segments are
+ * computed the same way as in Simulator::simTropo. Default simulation parameters: Cn = 1.8e-7, H = 2000 m,
+ * dh = 200 m, ve = 8 m/s.
+ *
+ * build: cmake -DBUILD_BENCHMARKS=ON -DCMAKE_BUILD_TYPE=Release
+ * usage: benchmark_tropo [number of observations ...] (default: 200 500 1000)
+ */
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/format.hpp>
+
+#include "../Misc/Constants.h"
+#include "../Simulator/TurbulenceCovariance.h"
+
+using namespace std;
+using namespace VieVS;
+using namespace Eigen;
+
+namespace {
+
+const double Cn = 1.8e-7;
+const double H = 2000;
+const double dh = 200;
+const double vn = 0;
+const double ve = 8;
+const double dhseg = 2;
+const unsigned int duration = 86400;
+
+
+/**
+ * @brief previous implementation of the covariance between two observations (reference)
+ *
+ * one object per station, geometry is recomputed for every pair of observations
+ */
+class ReferenceCovariance {
+   public:
+    ReferenceCovariance( const vector<double> &az, const vector<double> &el, const vector<double> &time )
+        : az_{ az }, el_{ el }, time_{ time } {
+        const int nh = floor( H / dh );
+        rho4x_ = VectorXd( ( nh + 1 ) * ( nh + 1 ) );
+        z_ = VectorXd( ( nh + 1 ) * ( nh + 1 ) );
+        zs_ = VectorXd( ( nh + 1 ) * ( nh + 1 ) );
+        int c = 0;
+        for ( int i = 0; i < nh + 1; ++i ) {
+            double zs_s = dh * i;
+            for ( int j = 0; j < nh + 1; ++j ) {
+                double z_s = dh * j;
+                double rho4 = abs( z_s - zs_s );
+                double tmp = cbrt( rho4 );
+                tmp = tmp * tmp;
+                rho4x_( c ) = tmp / ( 1 + tmp / L23_ );
+                z_( c ) = z_s;
+                zs_( c ) = zs_s;
+                ++c;
+            }
+        }
+    }
+
+    double operator()( unsigned long i1, unsigned long i2 ) const {
+        const double Cnall = Cn * Cn / 2 * 1e6 * dh * dh;
+        const Vector3d v( vn * 3600, ve * 3600, 0 );
+        const double L23 = L23_;
+        auto cbrtx = []( double d ) { return cbrt( d ); };
+
+        double t1_h = time_[i1] / 3600.;
+        Vector3d r1 = calcR( i1 );
+        MatrixXd rz1 = r1 * z_.transpose();
+
+        MatrixXd dd1 = rz1;
+        dd1.row( 2 ) -= zs_;
+        dd1 = dd1.colwise() + v * t1_h;
+
+        VectorXd rho1 = ( dd1.array() * dd1.array() ).colwise().sum().unaryExpr( cbrtx );
+        VectorXd rho1x = rho1.array() / ( 1 + rho1.array() / L23 );
+
+        double t2_h = time_[i2] / 3600.;
+        Vector3d r2 = calcR( i2 );
+        MatrixXd rz2 = r2 * z_.transpose();
+
+        MatrixXd dd2 = rz2;
+        dd2.row( 2 ) -= zs_;
+        dd2 = dd2.colwise() + v * t2_h;
+
+        VectorXd rho2 = ( dd2.array() * dd2.array() ).colwise().sum().unaryExpr( cbrtx );
+
+        double dt12_h = t2_h - t1_h;
+        MatrixXd rzs2 = r2 * zs_.transpose();
+
+        MatrixXd dd3 = rz1 - rzs2;
+        dd3 = dd3.colwise() - v * dt12_h;
+        VectorXd rho3 = ( dd3.array() * dd3.array() ).colwise().sum().unaryExpr( cbrtx );
+
+        double result = ( rho1x.array() + rho2.array() / ( 1 + rho2.array() / L23 ) -
+                          rho3.array() / ( 1 + rho3.array() / L23 ) - rho4x_.array() )
+                            .sum();
+        return Cnall * result;
+    }
+
+   private:
+    const double L23_ = pow( 3e6, 2.0 / 3.0 );
+    const vector<double> &az_;
+    const vector<double> &el_;
+    const vector<double> &time_;
+    VectorXd rho4x_;
+    VectorXd z_;
+    VectorXd zs_;
+
+    Vector3d calcR( unsigned long i ) const {
+        return Vector3d( cos( az_[i] ) / tan( el_[i] ), sin( az_[i] ) / tan( el_[i] ), 1 );
+    }
+};
+
+
+/**
+ * @brief covariance blocks of all consecutive segments (same loop structure as Simulator::simTropo)
+ */
+template <typename Covariance>
+vector<MatrixXd> covarianceBlocks( Covariance &covariance, const VectorXd &tn ) {
+    const int segments = tn.size();
+    vector<MatrixXd> blocks;
+    MatrixXd C11 = MatrixXd::Zero( 0, 0 );
+    for ( int i1 = 0; i1 < segments - 1; ++i1 ) {
+        int i2 = i1 + 1;
+        int num1 = tn( i1 );
+        int num2 = tn( i2 );
+        int k = tn.head( i1 ).sum();
+        if ( i2 == 1 ) {
+            num2 += num1;
+            num1 = 0;
+            k = 0;
+        }
+        int num3 = num1 + num2;
+
+        MatrixXd C = MatrixXd::Zero( num3, num3 );
+        C.topLeftCorner( num1, num1 ) = C11;
+        for ( int i = 0; i < num3; ++i ) {
+            for ( int j = max( i, num1 ); j < num3; ++j ) {
+                C( j, i ) = covariance( k + i, k + j );
+            }
+        }
+        C11 = C.bottomRightCorner( tn( i2 ), tn( i2 ) );
+        blocks.push_back( move( C ) );
+    }
+    return blocks;
+}
+
+}  // namespace
+
+
+int main( int argc, char *argv[] ) {
+    vector<unsigned long> nobsList;
+    for ( int i = 1; i < argc; ++i ) {
+        nobsList.push_back( stoul( argv[i] ) );
+    }
+    if ( nobsList.empty() ) {
+        nobsList = { 200, 500, 1000 };
+    }
+
+    cout << "turbulence covariance of one station, 24h session, H = 2000 m, dh = 200 m\n";
+    cout << "   nobs   reference [s]     current [s]   speedup   max rel. diff\n";
+    for ( unsigned long nobs : nobsList ) {
+        // synthetic observations: uniform in time, random azimuth, elevation above 5 degrees
+        mt19937_64 generator( 1 );
+        uniform_real_distribution<double> azDist( 0, twopi );
+        uniform_real_distribution<double> elDist( 5 * deg2rad, halfpi );
+        vector<double> az( nobs );
+        vector<double> el( nobs );
+        vector<double> time( nobs );
+        const int segments = ceil( duration / ( dhseg * 3600 ) );
+        VectorXd tn = VectorXd::Zero( segments );
+        for ( unsigned long i = 0; i < nobs; ++i ) {
+            az[i] = azDist( generator );
+            el[i] = elDist( generator );
+            time[i] = floor( ( i + 0.5 ) * duration / nobs );
+            ++tn( static_cast<int>( time[i] / ( dhseg * 3600 ) ) );
+        }
+
+        auto start = chrono::steady_clock::now();
+        ReferenceCovariance reference( az, el, time );
+        vector<MatrixXd> blocksReference = covarianceBlocks( reference, tn );
+        auto mid = chrono::steady_clock::now();
+        TurbulenceCovariance current( az, el, time, Cn, H, dh, vn, ve );
+        vector<MatrixXd> blocksCurrent = covarianceBlocks( current, tn );
+        auto finish = chrono::steady_clock::now();
+
+        double maxRelDiff = 0;
+        for ( unsigned long i = 0; i < blocksReference.size(); ++i ) {
+            const MatrixXd &ref = blocksReference[i];
+            const MatrixXd &cur = blocksCurrent[i];
+            for ( long c = 0; c < ref.cols(); ++c ) {
+                for ( long r = c; r < ref.rows(); ++r ) {
+                    if ( ref( r, c ) != 0 ) {
+                        maxRelDiff = max( maxRelDiff, abs( cur( r, c ) - ref( r, c ) ) / abs( ref( r, c ) ) );
+                    }
+                }
+            }
+        }
+
+        double tReference = chrono::duration<double>( mid - start ).count();
+        double tCurrent = chrono::duration<double>( finish - mid ).count();
+        cout << boost::format( "%7d %15.3f %15.3f %9.1f %15.1e\n" ) % nobs % tReference % tCurrent %
+                    ( tReference / tCurrent ) % maxRelDiff;
+    }
+    return 0;
+}
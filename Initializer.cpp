@@ -85,7 +85,8 @@ void Initializer::precalcSubnettingSrcIds() noexcept {
         }
     }
 
-    preCalculated_.subnettingSrcIds = subnettingSrcIds;
+    preCalculated_.subnettingSrcIds =
+        make_shared<const vector<vector<unsigned long>>>( move( subnettingSrcIds ) );
 }
 
 
@@ -1101,7 +1102,7 @@ void Initializer::createSatellitesToAvoid( ofstream &of ) noexcept {
                             src_flux[band] = make_unique<Flux_constant>( ObservingMode::wavelengths[band], 0 );
                         }
                         auto src = make_shared<Satellite>( header, line1, line2, src_flux );
-                        AvoidSatellites::satellitesToAvoid.push_back( src );
+                        AvoidSatellites::satellitesToAvoid.edit().push_back( src );
                         ++created;
                         src_created.push_back( header );
 #ifdef VIESCHEDPP_LOG
@@ -1222,6 +1223,7 @@ void Initializer::initializeGeneral( ofstream &of ) noexcept {
             parameters_.subnettingMinNStaAllBut = subnettingMinNStaAllBut.get();
             parameters_.subnettingMinNStaPercent_otherwiseAllBut = false;
         }
+        parameters_.subnettingMaxSplits = xml_.get( "VieSchedpp.general.subnettingMaxSplits", 0u );
 
         parameters_.fillinmodeDuringScanSelection =
             xml_.get( "VieSchedpp.general.fillinmodeDuringScanSelection", false );
@@ -1258,6 +1260,7 @@ void Initializer::initializeGeneral( ofstream &of ) noexcept {
             xml_.get( "VieSchedpp.general.doNotObserveSourcesWithinMinRepeat", true );
         parameters_.ignoreSuccessiveScansSameSrc =
             xml_.get( "VieSchedpp.general.ignore_successive_scans_same_source", true );
+        parameters_.incrementalSubcon = xml_.get( "VieSchedpp.general.incrementalSubcon", true );
 
     } catch ( const boost::property_tree::ptree_error &e ) {
         of << "ERROR: reading VieSchedpp.xml file!" << endl;
@@ -1433,25 +1436,14 @@ void Initializer::initializeStations() noexcept {
 
 
 void Initializer::precalcAzElStations() noexcept {
+    const auto &q = sourceList_.getQuasars();
+    const auto &s = sourceList_.getSatellites();
+    vector<shared_ptr<const AbstractSource>> quasars( q.begin(), q.end() );
+    vector<shared_ptr<const AbstractSource>> satellites( s.begin(), s.end() );
+
     for ( auto &sta : network_.refStations() ) {
-        for ( const auto &source : sourceList_.getQuasars() ) {
-            int step = 600;
-            PointingVector npv( sta.getId(), source->getId() );
-            for ( unsigned int t = 0; t < TimeSystem::duration + 1800; t += step ) {
-                npv.setTime( t );
-                sta.calcAzEl_rigorous( source, npv );
-            }
-        }
-        for ( const auto &source : sourceList_.getSatellites() ) {
-//            ofstream o("/scratch/programming/tmp/"+sta.getName()+".csv");
-            int step = 60;
-            PointingVector npv( sta.getId(), source->getId() );
-            for ( unsigned int t = 0; t < TimeSystem::duration + 1800; t += step ) {
-                npv.setTime( t );
-                sta.calcAzEl_rigorous( source, npv );
-//                o << boost::format("%f,%f,%f\n")% (TimeSystem::mjdStart+t/86400) % (npv.getAz()*rad2deg) % (npv.getEl()*rad2deg);
-            }
-        }
+        sta.precalcAzEl( quasars, 600, TimeSystem::duration + 1800 );
+        sta.precalcAzEl( satellites, 60, TimeSystem::duration + 1800 );
     }
 }
 
@@ -2414,9 +2406,9 @@ void Initializer::initializeAstronomicalParameteres() noexcept {
             sunra = sunra + 2 * pi;
         }
         double sunde = asin( sin( obliq ) * sin( ecllon ) );
-        AstronomicalParameters::sun_ra.push_back( sunra );
-        AstronomicalParameters::sun_dec.push_back( sunde );
-        AstronomicalParameters::sun_time.push_back( refTime );
+        AstronomicalParameters::sun_ra.edit().push_back( sunra );
+        AstronomicalParameters::sun_dec.edit().push_back( sunde );
+        AstronomicalParameters::sun_time.edit().push_back( refTime );
         ++counter;
     } while ( refTime < TimeSystem::duration + 3600 );
 }
@@ -2735,15 +2727,15 @@ void Initializer::initializeObservingMode( const SkdCatalogReader &skdCatalogs,
                         }
                     }
                 }
-                ObservingMode::minSNR[name] = minSNR;
+                ObservingMode::minSNR.edit()[name] = minSNR;
 
-                ObservingMode::stationProperty[name] = station_property;
-                ObservingMode::stationBackup[name] = station_backup;
-                ObservingMode::stationBackupValue[name] = station_backupValue;
+                ObservingMode::stationProperty.edit()[name] = station_property;
+                ObservingMode::stationBackup.edit()[name] = station_backup;
+                ObservingMode::stationBackupValue.edit()[name] = station_backupValue;
 
-                ObservingMode::sourceProperty[name] = source_property;
-                ObservingMode::sourceBackup[name] = source_backup;
-                ObservingMode::sourceBackupValue[name] = source_backupValue;
+                ObservingMode::sourceProperty.edit()[name] = source_property;
+                ObservingMode::sourceBackup.edit()[name] = source_backup;
+                ObservingMode::sourceBackupValue.edit()[name] = source_backupValue;
             }
         }
     }
@@ -3228,6 +3220,27 @@ void Initializer::applyMultiSchedParameters(const VieVS::MultiScheduling::Parame
 }
 
 
+double Initializer::estimateCost( const VieVS::MultiScheduling::Parameters &parameters ) const noexcept {
+    bool subnetting = parameters.subnetting.get_value_or( parameters_.subnetting );
+    bool fillinDuring = parameters.fillinmode_influenceOnScanSelection.get_value_or(
+        parameters.fillinmode_duringScanSelection.get_value_or( parameters_.fillinmodeDuringScanSelection ) );
+    bool fillinAPosteriori = parameters.fillinmode_aPosteriori.get_value_or( parameters_.fillinmodeAPosteriori );
+
+    double cost = static_cast<double>( sourceList_.getNSrc() ) * static_cast<double>( network_.getNSta() );
+    if ( subnetting ) {
+        // every pair of sources is a subnetting candidate
+        cost *= 4.0;
+    }
+    if ( fillinDuring ) {
+        cost *= 2.0;
+    }
+    if ( fillinAPosteriori ) {
+        cost *= 1.5;
+    }
+    return cost;
+}
+
+
 vector<MultiScheduling::Parameters> Initializer::readMultiSched( std::ostream &out ) {
     vector<MultiScheduling::Parameters> para;
 
@@ -3250,7 +3263,7 @@ vector<MultiScheduling::Parameters> Initializer::readMultiSched( std::ostream &o
         for ( const auto &any : mstree ) {
             std::string name = any.first;
             if ( name == "maxNumber" || name == "seed" || name == "version" || name == "version_offset" ||
-                 name == "genetic" ) {
+                 name == "genetic" || name == "checkpoint" ) {
                 continue;
             }
             if ( name == "pick_random" ) {
@@ -3393,7 +3406,7 @@ void Initializer::initializeSourceSequence() noexcept {
                     }
                 }
                 if ( !all ) {
-                    Scan::scanSequence_target[c] = targetIds;
+                    Scan::scanSequence_target.edit()[c] = targetIds;
                 }
                 ++c;
             }
@@ -3434,7 +3447,7 @@ void Initializer::initializeCalibrationBlocks() {
         CalibratorBlock::averageBaseline_offset = tree->get( "averageBaseline_offset", 1.0 );
         for ( const auto &any : *tree ) {
             if ( any.first == "block" ) {
-                unsigned int time = any.second.get( "startTime", TimeSystem::duration );
+                unsigned int time = any.second.get( "startTime", TimeSystem::duration.get() );
                 unsigned int scans = any.second.get( "scans", 2 );
                 unsigned int duration = any.second.get( "duration", 300 );
                 unsigned int overlap = any.second.get( "overlap", 2 );
@@ -3477,18 +3490,18 @@ void Initializer::initializeCalibrationBlocks() {
                 for ( const auto &any : *angles ) {
                     if ( any.first == "angle" ) {
                         auto v = any.second.get_value<double>();
-                        DifferentialParallacticAngleBlock::angles.push_back( v * deg2rad );
+                        DifferentialParallacticAngleBlock::angles.edit().push_back( v * deg2rad );
                         ++counter;
                     }
                 }
                 // fill missing values with 45 degrees
                 for ( int i = counter; i < DifferentialParallacticAngleBlock::nscans; ++i ) {
-                    DifferentialParallacticAngleBlock::angles.push_back( 45.0 * deg2rad );
+                    DifferentialParallacticAngleBlock::angles.edit().push_back( 45.0 * deg2rad );
                 }
             } else {
                 // fill empty angles with 45 degrees for backwards comperability
                 for ( int i = 0; i < DifferentialParallacticAngleBlock::nscans; ++i ) {
-                    DifferentialParallacticAngleBlock::angles.push_back( 45.0 * deg2rad );
+                    DifferentialParallacticAngleBlock::angles.edit().push_back( 45.0 * deg2rad );
                 }
             }
 
@@ -3669,7 +3682,7 @@ unsigned int Initializer::minutesVisible( std::shared_ptr<const AbstractSource>
 }
 
 
-void Initializer::statisticsLogHeader( ofstream &of, const std::vector<VieVS::MultiScheduling::Parameters> &ms ) {
+void Initializer::statisticsLogHeader( ostream &of, const std::vector<VieVS::MultiScheduling::Parameters> &ms ) {
     of << "version,n_scans,n_single_source_scans,n_subnetting_scans,n_fillin-mode_scans,n_calibrator_scans,n_"
           "observations,n_stations,n_sources,time_average_observation,time_average_preob,time_average_slew,time_"
           "average_idle,time_average_field_system,sky-coverage_average_13_areas_30_min,sky-coverage_average_25_areas_"
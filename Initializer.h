@@ -124,6 +124,7 @@ class Initializer : public VieVS_Object {
         bool subnettingMinNStaPercent_otherwiseAllBut = false;  ///< if set to true percentage value is used for
                                                                 ///< subnetting minimum number of station calculation
                                                                 ///< otherwise all but value
+        unsigned int subnettingMaxSplits = 0;                   ///< maximum number of station splits per source pair
 
         bool fillinmodeDuringScanSelection = true;  ///< schedule fillin mode scans
         bool fillinmodeInfluenceOnSchedule = true;  ///< fillin modes scans influence schedule
@@ -147,6 +148,7 @@ class Initializer : public VieVS_Object {
         bool ignoreSuccessiveScansSameSrc = true;  ///< ignore successive scans to same source
         bool doNotObserveSourcesWithinMinRepeat =
             true;  ///< consider scans (with reduced weight) if they are within min repeat time
+        bool incrementalSubcon = true;  ///< reuse unaffected candidates of previous scan selection
 
         bool andAsConditionCombination = true;  ///< backup for condition combination. TRUE = and, FALSE = or
     };
@@ -156,8 +158,10 @@ class Initializer : public VieVS_Object {
      * @author Matthias Schartner
      */
     struct PRECALC {
-        std::vector<std::vector<unsigned long>>
-            subnettingSrcIds;  ///< list of all available second sources in subnetting
+        std::shared_ptr<const std::vector<std::vector<unsigned long>>> subnettingSrcIds =
+            std::make_shared<const std::vector<std::vector<unsigned long>>>();  ///< list of all available second
+                                                                                ///< sources in subnetting (shared
+                                                                                ///< between copies)
     };
 
 
@@ -385,6 +389,19 @@ class Initializer : public VieVS_Object {
     void applyMultiSchedParameters(const VieVS::MultiScheduling::Parameters &parameters, int version);
 
 
+    /**
+     * @brief rough relative cost of creating a schedule with these multi scheduling parameters
+     * @author Matthias Schartner
+     *
+     * number of sources times number of stations, scaled by the features which are enabled (subnetting, fillin modes)
+     * Only used to order schedules before they are processed in parallel.
+     *
+     * @param parameters multi scheduling parameters
+     * @return cost estimate
+     */
+    double estimateCost( const VieVS::MultiScheduling::Parameters &parameters ) const noexcept;
+
+
     /**
      * @brief reads multiSched block from VieSchedpp.xml file
      * @author Matthias Schartner
@@ -412,10 +429,10 @@ class Initializer : public VieVS_Object {
      * @brief writes statistics log header
      * @author Matthias Schartner
      *
-     * @param of outstream to statistics.csv file
+     * @param of outstream for statistics header
      * @param ms vector multi scheduling parameters
      */
-    void statisticsLogHeader( std::ofstream &of, const std::vector<VieVS::MultiScheduling::Parameters> &ms );
+    void statisticsLogHeader( std::ostream &of, const std::vector<VieVS::MultiScheduling::Parameters> &ms );
 
 
     /**
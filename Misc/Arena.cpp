@@ -0,0 +1,76 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Arena.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+thread_local Arena Arena::threadArena_;
+thread_local unsigned int Arena::nScopes_ = 0;
+
+
+Arena::Scope::Scope() noexcept : mark_{ threadArena_.mark() } { ++nScopes_; }
+
+
+Arena::Scope::~Scope() {
+    threadArena_.rewind( mark_ );
+    --nScopes_;
+}
+
+
+pmr::memory_resource *Arena::resource() noexcept {
+    if ( nScopes_ > 0 ) {
+        return &threadArena_;
+    }
+    return pmr::get_default_resource();
+}
+
+
+size_t Arena::capacity() const noexcept {
+    size_t size = 0;
+    for ( const auto &chunk : chunks_ ) {
+        size += chunk.size;
+    }
+    return size;
+}
+
+
+void *Arena::do_allocate( size_t bytes, size_t alignment ) {
+    while ( true ) {
+        if ( current_ < chunks_.size() ) {
+            Chunk &chunk = chunks_[current_];
+            auto base = reinterpret_cast<uintptr_t>( chunk.data.get() );
+            uintptr_t aligned = ( base + offset_ + alignment - 1 ) & ~( static_cast<uintptr_t>( alignment ) - 1 );
+            size_t start = aligned - base;
+            if ( start + bytes <= chunk.size ) {
+                offset_ = start + bytes;
+                return chunk.data.get() + start;
+            }
+
+            // chunk is full, continue with next one (skipped memory is reused after rewind)
+            ++current_;
+            offset_ = 0;
+            continue;
+        }
+
+        size_t size = max( chunkSize_, bytes + alignment );
+        chunks_.push_back( Chunk{ unique_ptr<char[]>( new char[size] ), size } );
+    }
+}
@@ -0,0 +1,203 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file Arena.h
+ * @brief class Arena
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+
+#ifndef VIESCHEDPP_ARENA_H
+#define VIESCHEDPP_ARENA_H
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+
+namespace VieVS {
+
+/**
+ * @class Arena
+ * @brief monotonic memory resource for short lived scan selection objects
+ *
+ * Memory is handed out by bumping a pointer through a list of chunks. Deallocation does nothing, all memory taken
+ * after a mark is reclaimed at once by rewinding to this mark. Chunks are kept for reuse, a warmed up arena therefore
+ * does not allocate at all.
+ *
+ * Each thread owns one arena. It is used while at least one Arena::Scope is alive on this thread, otherwise
+ * Arena::resource() falls back to the default memory resource. Objects allocated from the arena must not outlive the
+ * scope they were created in - copy them to long-lived storage instead (copies always use the default resource).
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+class Arena : public std::pmr::memory_resource {
+   public:
+    /**
+     * @brief position in arena
+     * @author Matthias Schartner
+     */
+    struct Mark {
+        std::size_t chunk;   ///< chunk index
+        std::size_t offset;  ///< offset in chunk
+    };
+
+
+    /**
+     * @class Scope
+     * @brief activates the arena of this thread and releases all memory allocated within its lifetime
+     *
+     * Scopes can be nested as long as they are destroyed in reverse order of creation.
+     *
+     * @author Matthias Schartner
+     * @date 17.10.2026
+     */
+    class Scope {
+       public:
+        /**
+         * @brief constructor
+         * @author Matthias Schartner
+         */
+        Scope() noexcept;
+
+
+        /**
+         * @brief destructor, rewinds arena to state at construction
+         * @author Matthias Schartner
+         */
+        ~Scope();
+
+
+        Scope( const Scope & ) = delete;
+
+        Scope &operator=( const Scope & ) = delete;
+
+       private:
+        Mark mark_;  ///< arena position at construction
+    };
+
+
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * @param chunkSize size of one chunk in bytes
+     */
+    explicit Arena( std::size_t chunkSize = 1u << 20u ) : chunkSize_{ chunkSize } {}
+
+
+    Arena( const Arena & ) = delete;
+
+    Arena &operator=( const Arena & ) = delete;
+
+
+    /**
+     * @brief memory resource for short lived objects
+     * @author Matthias Schartner
+     *
+     * @return arena of this thread if a scope is active, otherwise default memory resource
+     */
+    static std::pmr::memory_resource *resource() noexcept;
+
+
+    /**
+     * @brief current position
+     * @author Matthias Schartner
+     *
+     * @return mark
+     */
+    Mark mark() const noexcept { return { current_, offset_ }; }
+
+
+    /**
+     * @brief release all memory allocated after mark
+     * @author Matthias Schartner
+     *
+     * @param mark previous position
+     */
+    void rewind( const Mark &mark ) noexcept {
+        current_ = mark.chunk;
+        offset_ = mark.offset;
+    }
+
+
+    /**
+     * @brief total size of all chunks
+     * @author Matthias Schartner
+     *
+     * @return size in bytes
+     */
+    std::size_t capacity() const noexcept;
+
+   protected:
+    /**
+     * @brief allocate memory
+     * @author Matthias Schartner
+     *
+     * @param bytes number of bytes
+     * @param alignment alignment
+     * @return pointer to memory
+     */
+    void *do_allocate( std::size_t bytes, std::size_t alignment ) override;
+
+
+    /**
+     * @brief deallocate memory (does nothing, memory is released by rewind())
+     * @author Matthias Schartner
+     */
+    void do_deallocate( void *, std::size_t, std::size_t ) override {}
+
+
+    /**
+     * @brief memory resources are only equal to themselves
+     * @author Matthias Schartner
+     *
+     * @param other other memory resource
+     * @return true if other is this arena
+     */
+    bool do_is_equal( const std::pmr::memory_resource &other ) const noexcept override { return this == &other; }
+
+   private:
+    /**
+     * @brief block of memory
+     * @author Matthias Schartner
+     */
+    struct Chunk {
+        std::unique_ptr<char[]> data;  ///< memory
+        std::size_t size;              ///< size in bytes
+    };
+
+    static thread_local Arena threadArena_;     ///< arena of this thread
+    static thread_local unsigned int nScopes_;  ///< number of active scopes on this thread
+
+    std::size_t chunkSize_;      ///< default chunk size in bytes
+    std::vector<Chunk> chunks_;  ///< all chunks
+    std::size_t current_ = 0;    ///< index of current chunk
+    std::size_t offset_ = 0;     ///< offset in current chunk
+};
+
+}  // namespace VieVS
+
+#endif  // VIESCHEDPP_ARENA_H
@@ -22,25 +22,26 @@
 using namespace std;
 using namespace VieVS;
 
-bool AstrometricCalibratorBlock::scheduleCalibrationBlocks = false;
+thread_local SessionParameter<bool> AstrometricCalibratorBlock::scheduleCalibrationBlocks = false;
 
-unsigned int AstrometricCalibratorBlock::cadence = 0;
-AstrometricCalibratorBlock::CadenceUnit AstrometricCalibratorBlock::cadenceUnit =
+thread_local SessionParameter<unsigned int> AstrometricCalibratorBlock::cadence = 0;
+thread_local SessionParameter<AstrometricCalibratorBlock::CadenceUnit> AstrometricCalibratorBlock::cadenceUnit =
     AstrometricCalibratorBlock::CadenceUnit::seconds;
 
-unsigned int AstrometricCalibratorBlock::nextBlock = 0;
+thread_local SessionParameter<unsigned int> AstrometricCalibratorBlock::nextBlock = 0;
 
-std::vector<unsigned long> AstrometricCalibratorBlock::calibratorSourceIds{};
+thread_local SessionParameter<std::vector<unsigned long>> AstrometricCalibratorBlock::calibratorSourceIds{};
 
-unsigned int AstrometricCalibratorBlock::nmaxScans = 0;
+thread_local SessionParameter<unsigned int> AstrometricCalibratorBlock::nmaxScans = 0;
 
-AstrometricCalibratorBlock::TargetScanLengthType AstrometricCalibratorBlock::targetScanLengthType =
-    AstrometricCalibratorBlock::TargetScanLengthType::parameters;
-std::unordered_map<std::string, double> AstrometricCalibratorBlock::minSNR{};
-unsigned int AstrometricCalibratorBlock::scanLength = 0;
+thread_local SessionParameter<AstrometricCalibratorBlock::TargetScanLengthType>
+    AstrometricCalibratorBlock::targetScanLengthType =
+        AstrometricCalibratorBlock::TargetScanLengthType::parameters;
+thread_local SessionParameter<std::unordered_map<std::string, double>> AstrometricCalibratorBlock::minSNR{};
+thread_local SessionParameter<unsigned int> AstrometricCalibratorBlock::scanLength = 0;
 
-double AstrometricCalibratorBlock::lowElevationStartWeight = 0 * deg2rad;
-double AstrometricCalibratorBlock::lowElevationFullWeight = 0 * deg2rad;
+thread_local SessionParameter<double> AstrometricCalibratorBlock::lowElevationStartWeight = 0 * deg2rad;
+thread_local SessionParameter<double> AstrometricCalibratorBlock::lowElevationFullWeight = 0 * deg2rad;
 
-double AstrometricCalibratorBlock::highElevationStartWeight = 90 * deg2rad;
-double AstrometricCalibratorBlock::highElevationFullWeight = 90 * deg2rad;
+thread_local SessionParameter<double> AstrometricCalibratorBlock::highElevationStartWeight = 90 * deg2rad;
+thread_local SessionParameter<double> AstrometricCalibratorBlock::highElevationFullWeight = 90 * deg2rad;
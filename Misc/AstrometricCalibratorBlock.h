@@ -34,6 +34,7 @@
 #include <string>
 
 #include "Constants.h"
+#include "SessionParameter.h"
 
 
 namespace VieVS {
@@ -64,26 +65,31 @@ class AstrometricCalibratorBlock {
         seconds,     ///< fixed time in seconds
     };
 
-    static bool scheduleCalibrationBlocks;  ///< flag if calibration block should be scheduled
+    /// flag if calibration block should be scheduled
+    static thread_local SessionParameter<bool> scheduleCalibrationBlocks;
 
-    static unsigned int cadence;     ///< cadence
-    static CadenceUnit cadenceUnit;  ///< cadence unit
+    static thread_local SessionParameter<unsigned int> cadence;     ///< cadence
+    static thread_local SessionParameter<CadenceUnit> cadenceUnit;  ///< cadence unit
 
-    static unsigned int nextBlock;  ///< seconds/number of scans when next block should start
+    /// seconds/number of scans when next block should start
+    static thread_local SessionParameter<unsigned int> nextBlock;
 
-    static std::vector<unsigned long> calibratorSourceIds;  ///< list of calibrator sources
+    /// list of calibrator sources
+    static thread_local SessionParameter<std::vector<unsigned long>> calibratorSourceIds;
 
-    static unsigned int nmaxScans;  ///< maximum number of scans per calibrator block
+    static thread_local SessionParameter<unsigned int> nmaxScans;  ///< maximum number of scans per calibrator block
 
-    static TargetScanLengthType targetScanLengthType;       ///< target scan length type
-    static std::unordered_map<std::string, double> minSNR;  ///<  target minimum signal to noise ratio per band
-    static unsigned int scanLength;                         ///< target scan length in seconds
+    static thread_local SessionParameter<TargetScanLengthType> targetScanLengthType;       ///< target scan length type
+    /// target minimum signal to noise ratio per band
+    static thread_local SessionParameter<std::unordered_map<std::string, double>> minSNR;
+    /// target scan length in seconds
+    static thread_local SessionParameter<unsigned int> scanLength;
 
-    static double lowElevationStartWeight;  ///< low elevation start value in radians
-    static double lowElevationFullWeight;   ///< low elevation full value in radians
+    static thread_local SessionParameter<double> lowElevationStartWeight;  ///< low elevation start value in radians
+    static thread_local SessionParameter<double> lowElevationFullWeight;   ///< low elevation full value in radians
 
-    static double highElevationStartWeight;  ///< high elevation start value in radians
-    static double highElevationFullWeight;   ///< high elevation full value in radians
+    static thread_local SessionParameter<double> highElevationStartWeight;  ///< high elevation start value in radians
+    static thread_local SessionParameter<double> highElevationFullWeight;   ///< high elevation full value in radians
 };
 }  // namespace VieVS
 
@@ -18,19 +18,37 @@
 
 #include "AstronomicalParameters.h"
 
+#include "TimeSystem.h"
+#pragma push_macro("DAYSEC")
+#pragma push_macro("DC")
+#undef DAYSEC
+#include "sofa.h"
+#pragma pop_macro("DC")
+#pragma pop_macro("DAYSEC")
+
 
 using namespace VieVS;
 
-std::vector<double> AstronomicalParameters::earth_velocity;  ///< velocity of the earth
+thread_local SessionParameter<std::vector<double>> AstronomicalParameters::earth_velocity;  ///< velocity of the earth
+
+/// nutation x in one hour steps from IAU2006a model
+thread_local SessionParameter<std::vector<double>> AstronomicalParameters::earth_nutX;
+/// nutation y in one hour steps from IAU2006a model
+thread_local SessionParameter<std::vector<double>> AstronomicalParameters::earth_nutY;
+/// nutation s in one hour steps from IAU2006a model
+thread_local SessionParameter<std::vector<double>> AstronomicalParameters::earth_nutS;
+/// corresponding times of nut_x nut_y nut_s entries
+thread_local SessionParameter<std::vector<unsigned int>> AstronomicalParameters::earth_nutTime;
 
-std::vector<double> AstronomicalParameters::earth_nutX;           ///< nutation x in one hour steps from IAU2006a model
-std::vector<double> AstronomicalParameters::earth_nutY;           ///< nutation y in one hour steps from IAU2006a model
-std::vector<double> AstronomicalParameters::earth_nutS;           ///< nutation s in one hour steps from IAU2006a model
-std::vector<unsigned int> AstronomicalParameters::earth_nutTime;  ///< corresponding times of nut_x nut_y nut_s entries
+/// right ascension and declination of sun
+thread_local SessionParameter<std::vector<double>> AstronomicalParameters::sun_ra;
+/// right ascension and declination of sun
+thread_local SessionParameter<std::vector<double>> AstronomicalParameters::sun_dec;
+/// right ascension and declination of sun
+thread_local SessionParameter<std::vector<unsigned int>> AstronomicalParameters::sun_time;
 
-std::vector<double> AstronomicalParameters::sun_ra;          ///< right ascension and declination of sun
-std::vector<double> AstronomicalParameters::sun_dec;         ///< right ascension and declination of sun
-std::vector<unsigned int> AstronomicalParameters::sun_time;  ///< right ascension and declination of sun
+thread_local std::vector<AstronomicalParameters::EarthOrientation> AstronomicalParameters::earthOrientationCache_ =
+    std::vector<AstronomicalParameters::EarthOrientation>();  ///< cached earth orientation
 
 unsigned int AstronomicalParameters::getNutInterpolationIdx( unsigned int time ) {
     unsigned int nut_precalc_idx = 0;
@@ -72,3 +90,41 @@ double AstronomicalParameters::getNutS( unsigned int time, unsigned int interpol
                    delta * deltaTime;
     return S;
 }
+
+const AstronomicalParameters::EarthOrientation &AstronomicalParameters::getEarthOrientation( unsigned int time ) {
+    if ( earthOrientationCache_.empty() ) {
+        earthOrientationCache_.resize( nEarthOrientationCache );
+    }
+
+    EarthOrientation &eo = earthOrientationCache_[time % nEarthOrientationCache];
+    if ( eo.time == time && eo.mjdStart == TimeSystem::mjdStart ) {
+        return eo;
+    }
+
+    //  TIME
+    double date1 = 2400000.5;
+    double mjd = TimeSystem::mjdStart + static_cast<double>( time ) / 86400.0;
+
+    // Earth Rotation
+    double ERA = iauEra00( date1, mjd );
+
+    // precession nutation
+    double C[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+    unsigned int idx = getNutInterpolationIdx( time );
+    double x = getNutX( time, idx );
+    double y = getNutY( time, idx );
+    double s = getNutS( time, idx );
+    iauC2ixys( x, y, s, C );
+
+    //  Polar Motion
+    double W[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
+
+    //  GCRS to ITRS
+    iauC2tcio( C, ERA, W, eo.c2t );
+    iauTr( eo.c2t, eo.t2c );
+
+    eo.gmst = TimeSystem::mjd2gmst( mjd );
+    eo.time = time;
+    eo.mjdStart = TimeSystem::mjdStart;
+    return eo;
+}
@@ -28,8 +28,11 @@
 #define ASTRONOMICALPARAMETERS_H
 
 
+#include <limits>
 #include <vector>
 
+#include "SessionParameter.h"
+
 
 namespace VieVS {
 
@@ -44,21 +47,59 @@ namespace VieVS {
  */
 class AstronomicalParameters {
    public:
-    static std::vector<double> earth_velocity;  ///< velocity of the earth in m/s
+    static thread_local SessionParameter<std::vector<double>> earth_velocity;  ///< velocity of the earth in m/s
 
-    static std::vector<double> earth_nutX;           ///< nutation x in one hour steps from IAU2006a model
-    static std::vector<double> earth_nutY;           ///< nutation y in one hour steps from IAU2006a model
-    static std::vector<double> earth_nutS;           ///< nutation s in one hour steps from IAU2006a model
-    static std::vector<unsigned int> earth_nutTime;  ///< corresponding times of nut_x nut_y nut_s entries
+    /// nutation x in one hour steps from IAU2006a model
+    static thread_local SessionParameter<std::vector<double>> earth_nutX;
+    /// nutation y in one hour steps from IAU2006a model
+    static thread_local SessionParameter<std::vector<double>> earth_nutY;
+    /// nutation s in one hour steps from IAU2006a model
+    static thread_local SessionParameter<std::vector<double>> earth_nutS;
+    /// corresponding times of nut_x nut_y nut_s entries
+    static thread_local SessionParameter<std::vector<unsigned int>> earth_nutTime;
 
-    static std::vector<double> sun_ra;          ///< right ascension of sun in radians
-    static std::vector<double> sun_dec;         ///< declination of sun in radians
-    static std::vector<unsigned int> sun_time;  ///< corresponding times of sun_ra and sun_rc entries
+    static thread_local SessionParameter<std::vector<double>> sun_ra;          ///< right ascension of sun in radians
+    static thread_local SessionParameter<std::vector<double>> sun_dec;         ///< declination of sun in radians
+    /// corresponding times of sun_ra and sun_rc entries
+    static thread_local SessionParameter<std::vector<unsigned int>> sun_time;
 
     static unsigned int getNutInterpolationIdx( unsigned int time );
     static double getNutX( unsigned int time, unsigned int interpolationIdx );
     static double getNutY( unsigned int time, unsigned int interpolationIdx );
     static double getNutS( unsigned int time, unsigned int interpolationIdx );
+
+
+    /**
+     * @brief earth orientation at one epoch
+     *
+     * station and source independent part of the rigorous azimuth elevation model
+     *
+     * @author Matthias Schartner
+     */
+    struct EarthOrientation {
+        double mjdStart = 0;                                            ///< session start of this entry
+        unsigned int time = std::numeric_limits<unsigned int>::max();   ///< time in seconds since session start
+        double c2t[3][3] = {};                                          ///< celestial to terrestrial matrix
+        double t2c[3][3] = {};                                          ///< terrestrial to celestial matrix
+        double gmst = 0;                                                ///< greenwich mean sidereal time
+    };
+
+
+    /**
+     * @brief get earth orientation for one epoch
+     * @author Matthias Schartner
+     *
+     * Values are cached per thread so that all stations and sources evaluated at the same epoch share them.
+     *
+     * @param time time in seconds since session start
+     * @return earth orientation
+     */
+    static const EarthOrientation &getEarthOrientation( unsigned int time );
+
+   private:
+    static const unsigned int nEarthOrientationCache = 256;  ///< number of cached epochs per thread
+
+    static thread_local std::vector<EarthOrientation> earthOrientationCache_;  ///< cached epochs (index = time % n)
 };
 }  // namespace VieVS
 
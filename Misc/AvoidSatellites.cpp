@@ -7,16 +7,18 @@
 using namespace VieVS;
 using namespace std;
 
-std::vector<std::shared_ptr<VieVS::Satellite>> AvoidSatellites::satellitesToAvoid =
+thread_local SessionParameter<std::vector<std::shared_ptr<VieVS::Satellite>>> AvoidSatellites::satellitesToAvoid =
     std::vector<std::shared_ptr<VieVS::Satellite>>();  ///< list of satellites to be avoided during scheduling
 
-double AvoidSatellites::extraMargin = 0.2 * deg2rad;  /// set to 0.2 degree as a default
-double AvoidSatellites::orbitError = 2000;            /// set to 2 km by default
-double AvoidSatellites::orbitErrorPerDay = 2000;      /// set to 2 km by default
-double AvoidSatellites::minElevation = 20 * deg2rad;  /// set minimum elevation to 20 degrees
-int AvoidSatellites::frequency = 10;
-double AvoidSatellites::outputPercentage = 0.10;
-unordered_map<int, unordered_map<int, vector<pair<int, int>>>> AvoidSatellites::visible_{};
+thread_local SessionParameter<double> AvoidSatellites::extraMargin = 0.2 * deg2rad;  /// set to 0.2 degree as a default
+thread_local SessionParameter<double> AvoidSatellites::orbitError = 2000;            /// set to 2 km by default
+thread_local SessionParameter<double> AvoidSatellites::orbitErrorPerDay = 2000;      /// set to 2 km by default
+/// set minimum elevation to 20 degrees
+thread_local SessionParameter<double> AvoidSatellites::minElevation = 20 * deg2rad;
+thread_local SessionParameter<int> AvoidSatellites::frequency = 10;
+thread_local SessionParameter<double> AvoidSatellites::outputPercentage = 0.10;
+thread_local SessionParameter<unordered_map<int, unordered_map<int, vector<pair<int, int>>>>>
+    AvoidSatellites::visible_{};
 
 void AvoidSatellites::initialize( Network& network ) {
     unsigned int dt = 60;
@@ -82,7 +84,7 @@ void AvoidSatellites::initialize( Network& network ) {
                 endTime = TimeSystem::duration;
                 tmp.emplace_back( startTime, endTime );
             }
-            visible_[staid][satid] = tmp;
+            visible_.edit()[staid][satid] = tmp;
         }
     }
 }
@@ -6,6 +6,7 @@
 #define VIESCHEDPP_AVOIDSATELLITES_H
 
 #include "../Source/Satellite.h"
+#include "SessionParameter.h"
 
 namespace VieVS {
 /**
@@ -18,17 +19,18 @@ namespace VieVS {
 
 class AvoidSatellites {
    public:
-    static std::vector<std::shared_ptr<Satellite>> satellitesToAvoid;
-    static double extraMargin;
-    static double orbitError;
-    static double orbitErrorPerDay;
-    static double minElevation;
-    static int frequency;
-    static double outputPercentage;
+    static thread_local SessionParameter<std::vector<std::shared_ptr<Satellite>>> satellitesToAvoid;
+    static thread_local SessionParameter<double> extraMargin;
+    static thread_local SessionParameter<double> orbitError;
+    static thread_local SessionParameter<double> orbitErrorPerDay;
+    static thread_local SessionParameter<double> minElevation;
+    static thread_local SessionParameter<int> frequency;
+    static thread_local SessionParameter<double> outputPercentage;
 
     static void initialize( Network &network );
 
-    static std::unordered_map<int, std::unordered_map<int, std::vector<std::pair<int, int>>>> visible_;
+    static thread_local SessionParameter<std::unordered_map<int, std::unordered_map<int, std::vector<std::pair<int, int>>>>>
+        visible_;
 };
 }  // namespace VieVS
 
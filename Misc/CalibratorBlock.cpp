@@ -25,24 +25,24 @@ using namespace std;
 using namespace VieVS;
 
 unsigned long CalibratorBlock::nextId = 0;
-string CalibratorBlock::intent_;
-bool CalibratorBlock::tryToIncludeAllStationFlag = false;
-bool CalibratorBlock::subnetting = false;
-
-double CalibratorBlock::tryToIncludeAllStations_factor = 3;
-thread_local int CalibratorBlock::stationOverlap = 2;
-thread_local bool CalibratorBlock::rigorosStationOverlap = false;
-double CalibratorBlock::numberOfObservations_factor = 5.0;
-double CalibratorBlock::numberOfObservations_offset = 0.0;
-double CalibratorBlock::averageStations_factor = 100.0;
-double CalibratorBlock::averageStations_offset = 1.0;
-double CalibratorBlock::duration_factor = 0.2;
-double CalibratorBlock::duration_offset = 1.0;
-double CalibratorBlock::averageBaseline_factor = 0.0;
-double CalibratorBlock::averageBaseline_offset = 1.0;
-
-
-std::vector<int> thread_local CalibratorBlock::stationFlag = std::vector<int>();
+thread_local SessionParameter<string> CalibratorBlock::intent_;
+thread_local SessionParameter<bool> CalibratorBlock::tryToIncludeAllStationFlag = false;
+thread_local SessionParameter<bool> CalibratorBlock::subnetting = false;
+
+thread_local SessionParameter<double> CalibratorBlock::tryToIncludeAllStations_factor = 3;
+thread_local SessionParameter<int> CalibratorBlock::stationOverlap = 2;
+thread_local SessionParameter<bool> CalibratorBlock::rigorosStationOverlap = false;
+thread_local SessionParameter<double> CalibratorBlock::numberOfObservations_factor = 5.0;
+thread_local SessionParameter<double> CalibratorBlock::numberOfObservations_offset = 0.0;
+thread_local SessionParameter<double> CalibratorBlock::averageStations_factor = 100.0;
+thread_local SessionParameter<double> CalibratorBlock::averageStations_offset = 1.0;
+thread_local SessionParameter<double> CalibratorBlock::duration_factor = 0.2;
+thread_local SessionParameter<double> CalibratorBlock::duration_offset = 1.0;
+thread_local SessionParameter<double> CalibratorBlock::averageBaseline_factor = 0.0;
+thread_local SessionParameter<double> CalibratorBlock::averageBaseline_offset = 1.0;
+
+
+thread_local SessionParameter<std::vector<int>> CalibratorBlock::stationFlag = std::vector<int>();
 
 CalibratorBlock::CalibratorBlock( unsigned int startTime, unsigned int nScans, unsigned int duration,
                                   std::string allowedSourceGroup, int overlap, bool rigorosOverlap,
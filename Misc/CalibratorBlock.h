@@ -29,6 +29,7 @@
 
 #include <vector>
 
+#include "SessionParameter.h"
 #include "TimeSystem.h"
 #include "VieVS_Object.h"
 
@@ -68,23 +69,23 @@ class CalibratorBlock : public VieVS_Object {
     const std::vector<std::string> &getFocusSources() const { return focusSources; }
     const std::string &getFocusSourceGroup() const { return focusSourceGroup; }
 
-    static std::string intent_;
-    static bool tryToIncludeAllStationFlag;
-    static bool subnetting;
-
-    static double tryToIncludeAllStations_factor;
-    thread_local static int stationOverlap;
-    thread_local static bool rigorosStationOverlap;
-    static double numberOfObservations_factor;
-    static double numberOfObservations_offset;
-    static double averageStations_factor;
-    static double averageStations_offset;
-    static double duration_factor;
-    static double duration_offset;
-    static double averageBaseline_factor;
-    static double averageBaseline_offset;
-
-    static thread_local std::vector<int> stationFlag;
+    static thread_local SessionParameter<std::string> intent_;
+    static thread_local SessionParameter<bool> tryToIncludeAllStationFlag;
+    static thread_local SessionParameter<bool> subnetting;
+
+    static thread_local SessionParameter<double> tryToIncludeAllStations_factor;
+    static thread_local SessionParameter<int> stationOverlap;
+    static thread_local SessionParameter<bool> rigorosStationOverlap;
+    static thread_local SessionParameter<double> numberOfObservations_factor;
+    static thread_local SessionParameter<double> numberOfObservations_offset;
+    static thread_local SessionParameter<double> averageStations_factor;
+    static thread_local SessionParameter<double> averageStations_offset;
+    static thread_local SessionParameter<double> duration_factor;
+    static thread_local SessionParameter<double> duration_offset;
+    static thread_local SessionParameter<double> averageBaseline_factor;
+    static thread_local SessionParameter<double> averageBaseline_offset;
+
+    static thread_local SessionParameter<std::vector<int>> stationFlag;
     static std::vector<int> findBestIndices( const std::vector<std::vector<double>> &elevations, const std::vector<char> &isFocusScan );
 
    private:
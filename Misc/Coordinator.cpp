@@ -0,0 +1,393 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Coordinator.h"
+
+#include <boost/property_tree/json_parser.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#ifndef _WIN32
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+
+extern char **environ;
+#endif
+
+
+using namespace std;
+using namespace VieVS;
+
+
+Coordinator::Coordinator( std::string inputFile, unsigned short port, int timeout, bool remoteWorkers,
+                          std::string token )
+    : inputFile_{ move( inputFile ) },
+      token_{ move( token ) },
+      acceptor_{ ioContext_, boost::asio::ip::tcp::endpoint( remoteWorkers ? boost::asio::ip::address_v4::any()
+                                                                           : boost::asio::ip::address_v4::loopback(),
+                                                             port ) },
+      timeout_{ timeout } {
+    if ( token_.empty() ) {
+        random_device rd;
+        ostringstream oss;
+        oss << hex;
+        for ( int i = 0; i < 4; ++i ) {
+            oss << rd();
+        }
+        token_ = oss.str();
+    }
+    // local worker processes inherit the token
+#ifdef _WIN32
+    _putenv_s( "VIESCHEDPP_WORKER_TOKEN", token_.c_str() );
+#else
+    setenv( "VIESCHEDPP_WORKER_TOKEN", token_.c_str(), 1 );
+#endif
+
+    port_ = acceptor_.local_endpoint().port();
+    acceptor_.non_blocking( true );
+    acceptThread_ = thread( &Coordinator::acceptWorkers, this );
+
+#ifdef VIESCHEDPP_LOG
+    BOOST_LOG_TRIVIAL( info ) << "waiting for workers on port " << port_;
+#else
+    cout << "[info] waiting for workers on port " << port_ << "\n";
+#endif
+}
+
+
+Coordinator::~Coordinator() {
+    {
+        lock_guard<mutex> lock( mutex_ );
+        stop_ = true;
+    }
+    condition_.notify_all();
+
+    acceptThread_.join();
+    // no new connections after accept thread is finished
+    for ( auto &any : connections_ ) {
+        any.join();
+    }
+    for ( auto &any : localWorkers_ ) {
+        any.join();
+    }
+}
+
+
+int Coordinator::getNWorkers() const {
+    lock_guard<mutex> lock( mutex_ );
+    return nWorkers_;
+}
+
+
+void Coordinator::startLocalWorkers( const std::string &executable, int n ) {
+    for ( int i = 0; i < n; ++i ) {
+        {
+            lock_guard<mutex> lock( mutex_ );
+            ++nLocalWorkers_;
+        }
+        localWorkers_.emplace_back( &Coordinator::runLocalWorker, this, executable );
+    }
+}
+
+
+void Coordinator::runLocalWorker( const std::string &executable ) {
+    string address = "127.0.0.1:" + to_string( port_ );
+    for ( int restarts = 0;; ++restarts ) {
+        int status = -1;
+#ifdef _WIN32
+        string command = "\"" + executable + "\" --worker " + address;
+        status = system( command.c_str() );
+#else
+        string flag = "--worker";
+        char *argv[] = { const_cast<char *>( executable.c_str() ), const_cast<char *>( flag.c_str() ),
+                         const_cast<char *>( address.c_str() ), nullptr };
+        pid_t pid = 0;
+        if ( posix_spawnp( &pid, executable.c_str(), nullptr, nullptr, argv, environ ) == 0 ) {
+            {
+                lock_guard<mutex> lock( mutex_ );
+                localPids_.insert( pid );
+            }
+            waitpid( pid, &status, 0 );
+            lock_guard<mutex> lock( mutex_ );
+            localPids_.erase( pid );
+        }
+#endif
+        {
+            lock_guard<mutex> lock( mutex_ );
+            if ( stop_ ) {
+                break;
+            }
+        }
+        if ( restarts == maxRestarts ) {
+#ifdef VIESCHEDPP_LOG
+            BOOST_LOG_TRIVIAL( error ) << "local worker stopped " << maxRestarts + 1 << " times -> not restarted";
+#else
+            cout << "[error] local worker stopped " << maxRestarts + 1 << " times -> not restarted\n";
+#endif
+            break;
+        }
+#ifdef VIESCHEDPP_LOG
+        BOOST_LOG_TRIVIAL( warning ) << "local worker finished with status " << status << " -> restarted";
+#else
+        cout << "[warning] local worker finished with status " << status << " -> restarted\n";
+#endif
+    }
+
+    {
+        lock_guard<mutex> lock( mutex_ );
+        --nLocalWorkers_;
+    }
+    condition_.notify_all();
+}
+
+
+void Coordinator::process( const std::vector<Job> &jobs, StatisticsTable &statistics ) {
+    {
+        lock_guard<mutex> lock( mutex_ );
+        statistics_ = &statistics;
+        queue_.insert( queue_.end(), jobs.begin(), jobs.end() );
+        nPending_ += jobs.size();
+    }
+    condition_.notify_all();
+
+    // wait until all jobs are processed or no worker was available for longer than the timeout
+    unique_lock<mutex> lock( mutex_ );
+    auto lastWorker = chrono::steady_clock::now();
+    bool waiting = false;
+    while ( nPending_ > 0 ) {
+        condition_.wait_for( lock, chrono::seconds( 1 ) );
+        auto now = chrono::steady_clock::now();
+        if ( nWorkers_ > 0 || nLocalWorkers_ > 0 ) {
+            lastWorker = now;
+            waiting = false;
+            continue;
+        }
+        if ( !waiting && nPending_ > 0 ) {
+#ifdef VIESCHEDPP_LOG
+            BOOST_LOG_TRIVIAL( warning ) << "no worker available, waiting for workers on port " << port_;
+#else
+            cout << "[warning] no worker available, waiting for workers on port " << port_ << "\n";
+#endif
+            waiting = true;
+        }
+        if ( timeout_ > 0 && now - lastWorker > chrono::seconds( timeout_ ) ) {
+            for ( const auto &job : queue_ ) {
+#ifdef VIESCHEDPP_LOG
+                BOOST_LOG_TRIVIAL( error ) << util::version2prefix( job.version ) << "no worker available for "
+                                           << timeout_ << " seconds -> skipped";
+#else
+                cout << "[error] " << util::version2prefix( job.version ) << "no worker available for " << timeout_
+                     << " seconds -> skipped\n";
+#endif
+            }
+            nPending_ -= queue_.size();
+            queue_.clear();
+        }
+    }
+    statistics_ = nullptr;
+}
+
+
+void Coordinator::acceptWorkers() {
+    while ( true ) {
+        {
+            lock_guard<mutex> lock( mutex_ );
+            if ( stop_ ) {
+                break;
+            }
+        }
+
+        boost::system::error_code ec;
+        boost::asio::ip::tcp::socket socket( ioContext_ );
+        acceptor_.accept( socket, ec );
+        if ( ec == boost::asio::error::would_block || ec == boost::asio::error::try_again ) {
+            this_thread::sleep_for( chrono::milliseconds( 100 ) );
+            continue;
+        }
+        if ( ec ) {
+#ifdef VIESCHEDPP_LOG
+            BOOST_LOG_TRIVIAL( warning ) << "unable to accept worker: " << ec.message();
+#else
+            cout << "[warning] unable to accept worker: " << ec.message() << "\n";
+#endif
+            continue;
+        }
+
+        socket.non_blocking( false );
+        auto stream = make_shared<boost::asio::ip::tcp::iostream>( move( socket ) );
+        lock_guard<mutex> lock( mutex_ );
+        connections_.emplace_back( &Coordinator::serve, this, stream );
+    }
+    acceptor_.close();
+}
+
+
+void Coordinator::stopWorker( const std::string &name ) {
+    istringstream iss( name );
+    string host;
+    int pid = 0;
+    if ( !( iss >> host >> pid ) || host != boost::asio::ip::host_name() ) {
+        return;
+    }
+#ifndef _WIN32
+    // the pid is reported by the worker - only terminate processes which were started by this coordinator
+    lock_guard<mutex> lock( mutex_ );
+    if ( localPids_.find( pid ) != localPids_.end() ) {
+        kill( pid, SIGKILL );
+    }
+#endif
+}
+
+
+void Coordinator::serve( const std::shared_ptr<boost::asio::ip::tcp::iostream> &stream ) {
+    // every answer of the worker has to arrive within the timeout
+    auto setTimeout = [this, &stream]() {
+        if ( timeout_ > 0 ) {
+            stream->expires_after( chrono::seconds( timeout_ ) );
+        }
+    };
+
+    setTimeout();
+    string line;
+    if ( !getline( *stream, line ) ) {
+        return;
+    }
+    istringstream hello( line );
+    string keyword;
+    string token;
+    string name;
+    if ( !( hello >> keyword >> token ) || keyword != "hello" || token != token_ ) {
+#ifdef VIESCHEDPP_LOG
+        BOOST_LOG_TRIVIAL( warning ) << "worker with invalid token rejected";
+#else
+        cout << "[warning] worker with invalid token rejected\n";
+#endif
+        return;
+    }
+    getline( hello >> ws, name );
+    *stream << "input " << inputFile_ << endl;
+
+    {
+        lock_guard<mutex> lock( mutex_ );
+        ++nWorkers_;
+    }
+#ifdef VIESCHEDPP_LOG
+    BOOST_LOG_TRIVIAL( info ) << "worker " << name << " connected";
+#else
+    cout << "[info] worker " << name << " connected\n";
+#endif
+
+    while ( true ) {
+        Job job;
+        {
+            unique_lock<mutex> lock( mutex_ );
+            condition_.wait( lock, [this]() { return stop_ || !queue_.empty(); } );
+            if ( queue_.empty() ) {
+                break;
+            }
+            job = move( queue_.front() );
+            queue_.pop_front();
+        }
+
+        ostringstream json;
+        boost::property_tree::write_json( json, job.parameters.toPropertyTree(), false );
+        string parameters = json.str();
+        parameters.erase( parameters.find_last_not_of( "\r\n" ) + 1 );
+        setTimeout();
+        *stream << "job " << job.index << " " << parameters << endl;
+
+        // read result
+        vector<string> rows;
+        bool valid = false;
+        if ( getline( *stream, line ) ) {
+            istringstream iss( line );
+            string keyword;
+            int index = -1;
+            unsigned long n = 0;
+            if ( iss >> keyword >> index >> n && keyword == "done" && index == job.index ) {
+                valid = true;
+                for ( unsigned long i = 0; i < n; ++i ) {
+                    if ( !getline( *stream, line ) ) {
+                        valid = false;
+                        break;
+                    }
+                    rows.push_back( line );
+                }
+            }
+        }
+
+        if ( !valid ) {
+            // worker is lost or hangs - job is processed by another worker
+            bool timedOut = stream->error() == boost::asio::error::timed_out;
+            stream->close();
+            if ( timedOut ) {
+                stopWorker( name );
+            }
+            ++job.attempts;
+            {
+                lock_guard<mutex> lock( mutex_ );
+                --nWorkers_;
+                if ( job.attempts < maxAttempts ) {
+                    queue_.push_front( move( job ) );
+                } else {
+#ifdef VIESCHEDPP_LOG
+                    BOOST_LOG_TRIVIAL( error ) << util::version2prefix( job.version ) << "failed on " << maxAttempts
+                                               << " workers -> skipped";
+#else
+                    cout << "[error] " << util::version2prefix( job.version ) << "failed on " << maxAttempts
+                         << " workers -> skipped\n";
+#endif
+                    --nPending_;
+                }
+            }
+            condition_.notify_all();
+            if ( timedOut ) {
+#ifdef VIESCHEDPP_LOG
+                BOOST_LOG_TRIVIAL( warning ) << "worker " << name << " did not answer within " << timeout_
+                                             << " seconds -> disconnected";
+#else
+                cout << "[warning] worker " << name << " did not answer within " << timeout_
+                     << " seconds -> disconnected\n";
+#endif
+            } else {
+#ifdef VIESCHEDPP_LOG
+                BOOST_LOG_TRIVIAL( warning ) << "lost connection to worker " << name;
+#else
+                cout << "[warning] lost connection to worker " << name << "\n";
+#endif
+            }
+            return;
+        }
+
+        {
+            lock_guard<mutex> lock( mutex_ );
+            for ( const auto &row : rows ) {
+                statistics_->addRow( job.version, row );
+            }
+            --nPending_;
+        }
+        condition_.notify_all();
+    }
+
+    setTimeout();
+    *stream << "quit" << endl;
+    lock_guard<mutex> lock( mutex_ );
+    --nWorkers_;
+}
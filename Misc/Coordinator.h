@@ -0,0 +1,223 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file Coordinator.h
+ * @brief class Coordinator
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+
+#ifndef COORDINATOR_H
+#define COORDINATOR_H
+
+
+#include <boost/asio.hpp>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Output/StatisticsTable.h"
+#include "MultiScheduling.h"
+
+#ifdef VIESCHEDPP_LOG
+#include <boost/log/trivial.hpp>
+#endif
+
+
+namespace VieVS {
+/**
+ * @class Coordinator
+ * @brief distributes multi scheduling versions to worker processes
+ *
+ * Workers connect via TCP (see Worker class), they can run on this machine or on any other node which has access to
+ * the same file system. Each worker processes one version at a time and returns the corresponding statistics rows.
+ * Versions of a lost worker or of a worker which does not answer in time are handed to another worker. Local workers
+ * are restarted if they stop. Versions are skipped if no worker is available for longer than the timeout.
+ *
+ * The coordinator only listens on the loopback interface unless remote workers are enabled. Workers have to present
+ * the shared token (environment variable VIESCHEDPP_WORKER_TOKEN) in their first message. Only worker processes
+ * which were started by the coordinator itself are terminated if they do not answer in time.
+ *
+ * protocol (one message per line):
+ *  - worker: "hello <token> <host> <pid>", coordinator: "input <path to VieSchedpp.xml>"
+ *  - coordinator: "job <index> <multi scheduling parameters in json>", worker: "done <index> <n>" followed by n rows
+ *  - coordinator: "quit"
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+class Coordinator {
+   public:
+    /**
+     * @brief version which is processed by a worker
+     * @author Matthias Schartner
+     */
+    struct Job {
+        int index;                               ///< index of multi scheduling parameters
+        int version;                             ///< version number
+        MultiScheduling::Parameters parameters;  ///< multi scheduling parameters
+        int attempts = 0;                        ///< number of workers which failed to process this job
+    };
+
+
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * starts listening for workers
+     *
+     * @param inputFile path to VieSchedpp.xml file (sent to the workers)
+     * @param port TCP port (0 for any free port)
+     * @param timeout maximum time in seconds for one version and without any available worker (0 = no limit)
+     * @param remoteWorkers flag if workers on other machines can connect (otherwise listen on loopback only)
+     * @param token shared token workers have to present (empty = random token)
+     */
+    Coordinator( std::string inputFile, unsigned short port, int timeout = 3600, bool remoteWorkers = false,
+                 std::string token = "" );
+
+    Coordinator( const Coordinator & ) = delete;
+
+    Coordinator &operator=( const Coordinator & ) = delete;
+
+    /**
+     * @brief destructor
+     * @author Matthias Schartner
+     *
+     * stops all workers
+     */
+    ~Coordinator();
+
+
+    /**
+     * @brief get TCP port
+     * @author Matthias Schartner
+     *
+     * @return port workers connect to
+     */
+    unsigned short getPort() const noexcept { return port_; }
+
+
+    /**
+     * @brief get shared token
+     * @author Matthias Schartner
+     *
+     * @return token workers have to present
+     */
+    const std::string &getToken() const noexcept { return token_; }
+
+
+    /**
+     * @brief get number of connected workers
+     * @author Matthias Schartner
+     *
+     * @return number of connected workers
+     */
+    int getNWorkers() const;
+
+
+    /**
+     * @brief start worker processes on this machine
+     * @author Matthias Schartner
+     *
+     * worker processes are restarted if they stop before all versions are processed
+     *
+     * @param executable path to VieSched++ executable
+     * @param n number of worker processes
+     */
+    void startLocalWorkers( const std::string &executable, int n );
+
+
+    /**
+     * @brief process versions
+     * @author Matthias Schartner
+     *
+     * blocks until all versions are processed. Statistics rows are added to the statistics table.
+     *
+     * @param jobs versions to be processed
+     * @param statistics statistics table
+     */
+    void process( const std::vector<Job> &jobs, StatisticsTable &statistics );
+
+   private:
+    static const int maxAttempts = 3;   ///< maximum number of workers which try to process one job
+    static const int maxRestarts = 10;  ///< maximum number of restarts of one local worker
+
+    std::string inputFile_;                    ///< path to VieSchedpp.xml file
+    std::string token_;                        ///< shared token workers have to present
+    boost::asio::io_context ioContext_;        ///< asio context
+    boost::asio::ip::tcp::acceptor acceptor_;  ///< listening socket
+    unsigned short port_;                      ///< TCP port
+    int timeout_;                              ///< timeout in seconds (0 = no limit)
+    std::thread acceptThread_;                 ///< thread accepting new workers
+    std::vector<std::thread> connections_;     ///< one thread per connected worker
+    std::vector<std::thread> localWorkers_;    ///< one thread per local worker process
+    mutable std::mutex mutex_;                 ///< protects all members below
+    std::condition_variable condition_;        ///< signals new jobs, finished jobs and stop
+    std::deque<Job> queue_;                    ///< jobs which are not yet processed
+    unsigned long nPending_ = 0;               ///< jobs which are queued or in progress
+    StatisticsTable *statistics_ = nullptr;    ///< statistics table of current jobs
+    int nWorkers_ = 0;                         ///< number of connected workers
+    int nLocalWorkers_ = 0;                    ///< number of running local worker processes
+    std::set<int> localPids_;                  ///< process ids of running local worker processes
+    bool stop_ = false;                        ///< flag if workers should be stopped
+
+    /**
+     * @brief accept new workers until stopped
+     * @author Matthias Schartner
+     */
+    void acceptWorkers();
+
+
+    /**
+     * @brief run one local worker process, restart it if it stops
+     * @author Matthias Schartner
+     *
+     * @param executable path to VieSched++ executable
+     */
+    void runLocalWorker( const std::string &executable );
+
+
+    /**
+     * @brief terminate a worker which does not answer
+     * @author Matthias Schartner
+     *
+     * only worker processes started by this coordinator are terminated (not supported on Windows)
+     *
+     * @param name worker name ("<host> <pid>")
+     */
+    void stopWorker( const std::string &name );
+
+
+    /**
+     * @brief communicate with one worker
+     * @author Matthias Schartner
+     *
+     * @param stream connection to worker
+     */
+    void serve( const std::shared_ptr<boost::asio::ip::tcp::iostream> &stream );
+};
+}  // namespace VieVS
+
+#endif  // COORDINATOR_H
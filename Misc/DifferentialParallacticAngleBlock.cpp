@@ -7,12 +7,14 @@
 using namespace std;
 using namespace VieVS;
 
-string DifferentialParallacticAngleBlock::intent_;
-int DifferentialParallacticAngleBlock::cadence = 600;
-double DifferentialParallacticAngleBlock::distanceScaling = 2.0;
-unsigned int DifferentialParallacticAngleBlock::duration = 300;
-int DifferentialParallacticAngleBlock::nscans = 0;
-int thread_local DifferentialParallacticAngleBlock::iScan = 0;
-vector<unsigned long> DifferentialParallacticAngleBlock::allowedSources = vector<unsigned long>();
-vector<unsigned long> DifferentialParallacticAngleBlock::allowedBaseline = vector<unsigned long>();
-vector<double> DifferentialParallacticAngleBlock::angles = vector<double>();
+thread_local SessionParameter<string> DifferentialParallacticAngleBlock::intent_;
+thread_local SessionParameter<int> DifferentialParallacticAngleBlock::cadence = 600;
+thread_local SessionParameter<double> DifferentialParallacticAngleBlock::distanceScaling = 2.0;
+thread_local SessionParameter<unsigned int> DifferentialParallacticAngleBlock::duration = 300;
+thread_local SessionParameter<int> DifferentialParallacticAngleBlock::nscans = 0;
+thread_local SessionParameter<int> DifferentialParallacticAngleBlock::iScan = 0;
+thread_local SessionParameter<vector<unsigned long>> DifferentialParallacticAngleBlock::allowedSources =
+    vector<unsigned long>();
+thread_local SessionParameter<vector<unsigned long>> DifferentialParallacticAngleBlock::allowedBaseline =
+    vector<unsigned long>();
+thread_local SessionParameter<vector<double>> DifferentialParallacticAngleBlock::angles = vector<double>();
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <vector>
 
+#include "SessionParameter.h"
 #include "VieVS_Object.h"
 
 namespace VieVS {
@@ -21,15 +22,15 @@ namespace VieVS {
 
 class DifferentialParallacticAngleBlock : public VieVS_Object {
    public:
-    static std::string intent_;
-    static int cadence;
-    static double distanceScaling;
-    static std::vector<unsigned long> allowedSources;
-    static std::vector<unsigned long> allowedBaseline;
-    static unsigned int duration;
-    static int nscans;
-    static std::vector<double> angles;
-    static thread_local int iScan;
+    static thread_local SessionParameter<std::string> intent_;
+    static thread_local SessionParameter<int> cadence;
+    static thread_local SessionParameter<double> distanceScaling;
+    static thread_local SessionParameter<std::vector<unsigned long>> allowedSources;
+    static thread_local SessionParameter<std::vector<unsigned long>> allowedBaseline;
+    static thread_local SessionParameter<unsigned int> duration;
+    static thread_local SessionParameter<int> nscans;
+    static thread_local SessionParameter<std::vector<double>> angles;
+    static thread_local SessionParameter<int> iScan;
 
     static bool isAllowedSource( unsigned long srcid ) {
         return find( allowedSources.begin(), allowedSources.end(), srcid ) != allowedSources.end();
@@ -19,5 +19,5 @@
 #include "Flags.h"
 
 
-bool VieVS::Flags::logTrace = false;
-bool VieVS::Flags::logDebug = false;
+thread_local VieVS::SessionParameter<bool> VieVS::Flags::logTrace = false;
+thread_local VieVS::SessionParameter<bool> VieVS::Flags::logDebug = false;
@@ -27,6 +27,8 @@
 #ifndef VIESCHEDPP_FLAGS_H
 #define VIESCHEDPP_FLAGS_H
 
+#include "SessionParameter.h"
+
 namespace VieVS {
 
 /**
@@ -38,8 +40,8 @@ namespace VieVS {
  */
 class Flags {
    public:
-    static bool logTrace;  ///< write "trace" debug messages to log file
-    static bool logDebug;  ///< write "debug" debug messages to log file
+    static thread_local SessionParameter<bool> logTrace;  ///< write "trace" debug messages to log file
+    static thread_local SessionParameter<bool> logDebug;  ///< write "debug" debug messages to log file
 };
 }  // namespace VieVS
 
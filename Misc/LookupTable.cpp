@@ -25,51 +25,48 @@ using namespace std;
 std::vector<double> VieVS::LookupTable::sinLookupTable;
 std::vector<double> VieVS::LookupTable::cosLookupTable;
 std::vector<double> VieVS::LookupTable::acosLookupTable;
-vector<vector<vector<float>>> VieVS::LookupTable::angularDistanceLookup = {};
+std::vector<float> VieVS::LookupTable::angularDistanceLookup;
 
 
 void LookupTable::initialize() {
+    sinLookupTable.clear();
     for ( int i = 0; i < twopi * 1001; ++i ) {
         double x = i * 0.001;
         double val = sin( x );
         sinLookupTable.push_back( val );
     }
 
+    cosLookupTable.clear();
     for ( int i = 0; i < twopi * 1001; ++i ) {
         double x = i * 0.001;
         double val = cos( x );
         cosLookupTable.push_back( val );
     }
 
+    acosLookupTable.clear();
     for ( int i = 0; i < 2001; ++i ) {
         double x = -1 + i * 0.001;
         double val = acos( x );
         acosLookupTable.push_back( val );
     }
 
-    unsigned int maxEl = 91;
-    unsigned int sizeAz = 181;
-    vector<vector<vector<float>>> storage;
-
-    for ( unsigned int thisEl = 0; thisEl < maxEl; ++thisEl ) {
-        unsigned int sizeEl = maxEl - thisEl;
+    angularDistanceLookup.assign( angularDistanceIndex( nEl, 0, 0 ), 0 );
+    for ( long thisEl = 0; thisEl < nEl; ++thisEl ) {
+        long sizeEl = nEl - thisEl;
         double thisEl_rad = thisEl * deg2rad;
 
-        vector<vector<float>> thisStorage( sizeAz, vector<float>( sizeEl, 0 ) );
-
-        for ( int deltaAz = 0; deltaAz < sizeAz; ++deltaAz ) {
+        for ( long deltaAz = 0; deltaAz < nAz; ++deltaAz ) {
             double deltaAz_rad = deltaAz * deg2rad;
-            for ( int deltaEl = 0; deltaEl < sizeEl; ++deltaEl ) {
+            for ( long deltaEl = 0; deltaEl < sizeEl; ++deltaEl ) {
                 double deltaEl_rad = deltaEl * deg2rad;
 
                 double tmp = sinLookup( thisEl_rad ) * sinLookup( thisEl_rad + deltaEl_rad ) +
                              cosLookup( thisEl_rad ) * cosLookup( thisEl_rad + deltaEl_rad ) * cosLookup( deltaAz_rad );
                 double angle = acosLookup( tmp );
 
-                thisStorage[deltaAz][deltaEl] = static_cast<float>( angle );
+                angularDistanceLookup[angularDistanceIndex( thisEl, deltaAz, deltaEl )] = static_cast<float>( angle );
             }
         }
-        angularDistanceLookup.push_back( move( thisStorage ) );
     }
 }
 
@@ -85,26 +82,22 @@ double LookupTable::sinLookup( double x ) { return sinLookupTable[lround( x * 10
 double LookupTable::cosLookup( double x ) { return cosLookupTable[lround( x * 1000 )]; }
 
 
-double LookupTable::acosLookup( double x ) { return acosLookupTable.at( lround( x * 1000 ) + 1000 ); }
+double LookupTable::acosLookup( double x ) {
+    long idx = min( max( lround( x * 1000 ) + 1000, 0L ), 2000L );
+    return acosLookupTable[idx];
+}
 
 
 float LookupTable::angularDistance( double phi1, double theta1, double phi2, double theta2 ) noexcept {
-    if ( phi1 > phi2 ) {
-        swap( phi1, phi2 );
-    }
-    if ( theta1 > theta2 ) {
-        swap( theta1, theta2 );
-    }
-
-    double deltaPhi_tmp = ( phi2 - phi1 ) * rad2deg;
-    while ( deltaPhi_tmp > 180 ) {
-        deltaPhi_tmp = deltaPhi_tmp - 360;
-    }
-
-    long deltaPhi = abs( lround( deltaPhi_tmp ) );
+    // azimuth difference folded into [-180, 180] without branches
+    double deltaPhi_deg = ( phi2 - phi1 ) * rad2deg;
+    deltaPhi_deg -= 360. * nearbyint( deltaPhi_deg / 360. );
+    long deltaPhi = abs( lround( deltaPhi_deg ) );
 
-    auto thisTheta = lround( theta1 * rad2deg );
-    auto deltaTheta = lround( ( theta2 - theta1 ) * rad2deg );
+    double thetaLow = min( theta1, theta2 );
+    double thetaHigh = max( theta1, theta2 );
+    long thisTheta = min( max( lround( thetaLow * rad2deg ), 0L ), nEl - 1 );
+    long deltaTheta = min( lround( ( thetaHigh - thetaLow ) * rad2deg ), nEl - 1 - thisTheta );
 
-    return angularDistanceLookup[thisTheta][deltaPhi][deltaTheta];
+    return angularDistanceLookup[angularDistanceIndex( thisTheta, deltaPhi, deltaTheta )];
 }
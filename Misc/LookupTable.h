@@ -28,6 +28,8 @@
 #define LOOKUPTABLE_H
 
 
+#include <algorithm>
+#include <cmath>
 #include <unordered_map>
 #include <vector>
 
@@ -43,13 +45,24 @@ namespace VieVS {
  * the key is always an integer that counts in .001 intervals (using th sinLookup with a key of 327 would mean you
  * get sin(0.327) as a return value)
  *
+ * The angular distance table is stored in one contiguous triangular array: for each start elevation (1 degree steps)
+ * there is a block of 181 azimuth differences times the remaining elevation differences.
+ *
+ * The table is generated in initialize() and not constexpr: it is derived from the sin/cos/acos tables (std::sin and
+ * friends are not constexpr in C++17) and would add 3 MB to the binary. There is no batch interface on purpose:
+ * SkyCoverage::calcScore only visits the few observations in neighbouring elevation bands and in the influence time
+ * window via its index, thus there is no contiguous range of pointing vectors to pass. Accuracy and speed compared to
+ * the previous nested table and exact acos: Benchmark/LookupTableBenchmark.cpp (target benchmark_lookup_table).
+ *
  * @author Matthias Schartner
  * @date 02.08.2017
  */
 class LookupTable {
    private:
-    static std::vector<std::vector<std::vector<float>>>
-        angularDistanceLookup;  ///< lookup table for angular distance between two points
+    static constexpr long nEl = 91;  ///< number of elevation steps (0 to 90 degrees)
+    static constexpr long nAz = 181;  ///< number of azimuth difference steps (0 to 180 degrees)
+
+    static std::vector<float> angularDistanceLookup;  ///< lookup table for angular distance between two points
     static std::vector<double>
         sinLookupTable;  ///< table for fast lookup for sine function with reduced accuracy. Key is fraction of .001 pi
     static std::vector<double>
@@ -117,6 +130,23 @@ class LookupTable {
      * @return angular distance between two points in radians
      */
     static float angularDistance( double phi1, double theta1, double phi2, double theta2 ) noexcept;
+
+
+   private:
+    /**
+     * @brief index in angular distance table
+     * @author Matthias Schartner
+     *
+     * elevation block offset is sum over all previous blocks: nAz * ( nEl * el - el * ( el - 1 ) / 2 )
+     *
+     * @param el start elevation in degrees
+     * @param deltaAz azimuth difference in degrees
+     * @param deltaEl elevation difference in degrees
+     * @return index
+     */
+    static long angularDistanceIndex( long el, long deltaAz, long deltaEl ) noexcept {
+        return nAz * ( nEl * el - el * ( el - 1 ) / 2 ) + deltaAz * ( nEl - el ) + deltaEl;
+    }
 };
 }  // namespace VieVS
 
@@ -27,6 +27,7 @@ bool MultiScheduling::pick_random = false;
 unsigned long MultiScheduling::nsta_ = 0;
 unsigned long MultiScheduling::nsrc_ = 0;
 
+unsigned int MultiScheduling::seed_ = std::default_random_engine::default_seed;
 std::default_random_engine MultiScheduling::random_engine_ = std::default_random_engine();
 
 
@@ -924,6 +925,9 @@ vector<MultiScheduling::Parameters> MultiScheduling::evolution_step( int gen,
                                                                      const vector<MultiScheduling::Parameters> &old_pop,
                                                                      const std::map<int, double> &scores,
                                                                      const boost::property_tree::ptree &tree ) {
+    // every generation uses its own random number stream (independent of the number of draws in previous generations)
+    random_engine_ = std::default_random_engine( util::streamSeed( seed_, { static_cast<std::uint64_t>( gen ) } ) );
+
     vector<MultiScheduling::Parameters> new_pop;
     int n = tree.get( "VieSchedpp.multisched.genetic.population_size", 32 );
     double best_f = tree.get( "VieSchedpp.multisched.genetic.select_best_percent", 20.0 ) / 100;
@@ -974,7 +978,7 @@ vector<MultiScheduling::Parameters> MultiScheduling::evolution_step( int gen,
     tmp.erase( tmp.end() - best_n, tmp.end() );
 
     // randomly pick elements from remaining population
-    shuffle( tmp.begin(), tmp.end(), mt19937( random_device{}() ) );
+    shuffle( tmp.begin(), tmp.end(), random_engine_ );
     long i_rand = 0; // count number of random selections
     long c_rand = 0; // count number of random selection attempts
     while ( i_rand < random_n && c_rand < 3*random_n && c_rand < tmp.size()) {
@@ -995,9 +999,53 @@ vector<MultiScheduling::Parameters> MultiScheduling::evolution_step( int gen,
         ++i_rand;
     }
 
+    // surrogate model: predict scores of children based on all previous results
+    SurrogateModel surrogate;
+    vector<string> layout;
+    bool useSurrogate = false;
+    int nChildren = n;
+    double exploration = 1.0;
+    const auto &o_surrogate = tree.get_child_optional( "VieSchedpp.multisched.genetic.surrogate" );
+    if ( o_surrogate.is_initialized() ) {
+        int candidates = o_surrogate->get( "candidates", 8 );
+        auto maxSamples = o_surrogate->get<unsigned long>( "max_samples", 500 );
+        exploration = o_surrogate->get( "exploration", 1.0 );
+
+        // feature layout is taken from the most recent valid result
+        vector<vector<double>> x;
+        vector<double> y;
+        for ( long i = n_schedules - 1; i >= 0 && x.size() < maxSamples; --i ) {
+            if ( scores_vec[i] >= 1e-3 && isfinite( scores_vec[i] ) ) {
+                if ( layout.empty() ) {
+                    for ( const auto &any : old_pop[i].toFeatures() ) {
+                        layout.push_back( any.first );
+                    }
+                }
+                vector<double> features;
+                if ( old_pop[i].toFeatureVector( layout, features ) ) {
+                    x.push_back( move( features ) );
+                    y.push_back( scores_vec[i] );
+                }
+            }
+        }
+        if ( x.size() >= 8 && candidates > 1 && !layout.empty() ) {
+            useSurrogate = surrogate.fit( x, y );
+            if ( useSurrogate ) {
+                nChildren = n * candidates;
+            }
+        }
+#ifdef VIESCHEDPP_LOG
+        BOOST_LOG_TRIVIAL( info ) << boost::format( "surrogate model based on %d results: %s" ) % x.size() %
+                                         ( useSurrogate ? "used" : "not used" );
+#else
+        cout << boost::format( "[info] surrogate model based on %d results: %s\n" ) % x.size() %
+                    ( useSurrogate ? "used" : "not used" );
+#endif
+    }
+
     // get parents and make children
     auto gen_int = std::uniform_int_distribution<>( 0, parents.size() - 1 );
-    for ( int i = 0; i < n; ++i ) {
+    for ( int i = 0; i < nChildren; ++i ) {
         vector<Parameters> ps;
         vector<int> p_idx;
         for ( int ip = 0; ip < n_parents; ++ip ) {
@@ -1017,6 +1065,33 @@ vector<MultiScheduling::Parameters> MultiScheduling::evolution_step( int gen,
         any.normalizeWeights( nsta_, nsrc_ );
     }
 
+    // keep the children with the highest upper confidence bound of the predicted score
+    if ( useSurrogate ) {
+        vector<pair<double, unsigned long>> acquisition;
+        for ( unsigned long i = 0; i < new_pop.size(); ++i ) {
+            vector<double> features;
+            if ( !new_pop[i].toFeatureVector( layout, features ) ) {
+                continue;
+            }
+            double mean;
+            double sigma;
+            surrogate.predict( features, mean, sigma );
+            acquisition.emplace_back( mean + exploration * sigma, i );
+        }
+        sort( acquisition.begin(), acquisition.end(), greater<pair<double, unsigned long>>() );
+
+        vector<Parameters> selected;
+        auto nSelect = static_cast<unsigned long>( n );
+        for ( unsigned long i = 0; i < acquisition.size() && selected.size() < nSelect; ++i ) {
+            selected.push_back( new_pop[acquisition[i].second] );
+        }
+        if ( selected.size() == nSelect ) {
+            new_pop = move( selected );
+        } else {
+            new_pop.resize( n );
+        }
+    }
+
     return new_pop;
 }
 
@@ -1339,3 +1414,174 @@ void MultiScheduling::Parameters::normalizeWeights( unsigned long nsta, unsigned
         f( sourceWeight );
     }
 }
+
+
+namespace {
+/**
+ * @brief call function for each multi scheduling parameter (except start time)
+ * @author Matthias Schartner
+ *
+ * @tparam P (const) multi scheduling parameters
+ * @tparam F function taking name and member
+ * @param p multi scheduling parameters
+ * @param f function
+ */
+template <typename P, typename F>
+void forEachParameter( P &p, F &&f ) {
+    f( "subnetting", p.subnetting );
+    f( "subnetting_minSourceAngle", p.subnetting_minSourceAngle );
+    f( "subnetting_minParticipatingStations", p.subnetting_minParticipatingStations );
+    f( "fillinmode_duringScanSelection", p.fillinmode_duringScanSelection );
+    f( "fillinmode_influenceOnScanSelection", p.fillinmode_influenceOnScanSelection );
+    f( "fillinmode_aPosteriori", p.fillinmode_aPosteriori );
+    f( "focusCornerSwitchCadence", p.focusCornerSwitchCadence );
+
+    f( "weightSkyCoverage", p.weightSkyCoverage );
+    f( "weightNumberOfObservations", p.weightNumberOfObservations );
+    f( "weightDuration", p.weightDuration );
+    f( "weightAverageSources", p.weightAverageSources );
+    f( "weightAverageStations", p.weightAverageStations );
+    f( "weightAverageBaselines", p.weightAverageBaselines );
+    f( "weightIdleTime", p.weightIdleTime );
+    f( "weightIdleTime_interval", p.weightIdleTime_interval );
+    f( "weightClosures", p.weightClosures );
+    f( "weightMaxClosures", p.weightMaxClosures );
+    f( "weightLowDeclination", p.weightLowDeclination );
+    f( "weightLowDeclination_begin", p.weightLowDeclination_begin );
+    f( "weightLowDeclination_full", p.weightLowDeclination_full );
+    f( "weightLowElevation", p.weightLowElevation );
+    f( "weightLowElevation_begin", p.weightLowElevation_begin );
+    f( "weightLowElevation_full", p.weightLowElevation_full );
+
+    f( "skyCoverageInfluenceDistance", p.skyCoverageInfluenceDistance );
+    f( "skyCoverageInfluenceTime", p.skyCoverageInfluenceTime );
+
+    f( "stationWeight", p.stationWeight );
+    f( "stationMinSlewtime", p.stationMinSlewtime );
+    f( "stationMaxSlewtime", p.stationMaxSlewtime );
+    f( "stationMinSlewDistance", p.stationMinSlewDistance );
+    f( "stationMaxSlewDistance", p.stationMaxSlewDistance );
+    f( "stationMaxWait", p.stationMaxWait );
+    f( "stationMinElevation", p.stationMinElevation );
+    f( "stationMaxNumberOfScans", p.stationMaxNumberOfScans );
+    f( "stationMaxNumberOfScansDist", p.stationMaxNumberOfScansDist );
+    f( "stationMaxScan", p.stationMaxScan );
+    f( "stationMinScan", p.stationMinScan );
+
+    f( "sourceWeight", p.sourceWeight );
+    f( "sourceMinNumberOfSites", p.sourceMinNumberOfSites );
+    f( "sourceMinFlux", p.sourceMinFlux );
+    f( "sourceMaxNumberOfScans", p.sourceMaxNumberOfScans );
+    f( "sourceMinElevation", p.sourceMinElevation );
+    f( "sourceMinSunDistance", p.sourceMinSunDistance );
+    f( "sourceMaxScan", p.sourceMaxScan );
+    f( "sourceMinScan", p.sourceMinScan );
+    f( "sourceMinRepeat", p.sourceMinRepeat );
+
+    f( "baselineWeight", p.baselineWeight );
+    f( "baselineMaxScan", p.baselineMaxScan );
+    f( "baselineMinScan", p.baselineMinScan );
+}
+
+string toString( double value ) { return ( boost::format( "%.17g" ) % value ).str(); }
+
+template <typename T>
+string toString( T value ) {
+    return std::to_string( value );
+}
+
+template <typename T>
+void writeParameter( boost::property_tree::ptree &tree, const string &name, const boost::optional<T> &member ) {
+    if ( member.is_initialized() ) {
+        tree.add( name, toString( *member ) );
+    }
+}
+
+template <typename T>
+void writeParameter( boost::property_tree::ptree &tree, const string &name, const map<string, T> &member ) {
+    if ( member.empty() ) {
+        return;
+    }
+    // keys are added as child names directly (they might contain the path separator)
+    boost::property_tree::ptree values;
+    for ( const auto &any : member ) {
+        values.push_back( make_pair( any.first, boost::property_tree::ptree( toString( any.second ) ) ) );
+    }
+    tree.add_child( name, values );
+}
+
+template <typename T>
+void addFeatures( map<string, double> &features, const string &name, const boost::optional<T> &member ) {
+    if ( member.is_initialized() ) {
+        features[name] = static_cast<double>( *member );
+    }
+}
+
+template <typename T>
+void addFeatures( map<string, double> &features, const string &name, const map<string, T> &member ) {
+    for ( const auto &any : member ) {
+        features[name + "." + any.first] = static_cast<double>( any.second );
+    }
+}
+
+template <typename T>
+void readParameter( const boost::property_tree::ptree &tree, const string &name, boost::optional<T> &member ) {
+    member = tree.get_optional<T>( name );
+}
+
+template <typename T>
+void readParameter( const boost::property_tree::ptree &tree, const string &name, map<string, T> &member ) {
+    member.clear();
+    const auto &values = tree.get_child_optional( name );
+    if ( values.is_initialized() ) {
+        for ( const auto &any : *values ) {
+            member[any.first] = any.second.get_value<T>();
+        }
+    }
+}
+}  // namespace
+
+
+MultiScheduling::Parameters::Parameters( const boost::property_tree::ptree &tree ) {
+    auto o_start = tree.get_optional<string>( "start" );
+    if ( o_start.is_initialized() ) {
+        start = boost::posix_time::from_iso_string( *o_start );
+    }
+    forEachParameter( *this, [&tree]( const string &name, auto &member ) { readParameter( tree, name, member ); } );
+}
+
+
+boost::property_tree::ptree MultiScheduling::Parameters::toPropertyTree() const {
+    boost::property_tree::ptree tree;
+    if ( start.is_initialized() ) {
+        tree.add( "start", boost::posix_time::to_iso_string( *start ) );
+    }
+    forEachParameter( *this,
+                      [&tree]( const string &name, const auto &member ) { writeParameter( tree, name, member ); } );
+    return tree;
+}
+
+
+std::map<std::string, double> MultiScheduling::Parameters::toFeatures() const {
+    map<string, double> features;
+    forEachParameter( *this, [&features]( const string &name, const auto &member ) {
+        addFeatures( features, name, member );
+    } );
+    return features;
+}
+
+
+bool MultiScheduling::Parameters::toFeatureVector( const std::vector<std::string> &layout,
+                                                   std::vector<double> &x ) const {
+    map<string, double> features = toFeatures();
+    x.clear();
+    x.reserve( layout.size() );
+    for ( const auto &name : layout ) {
+        auto it = features.find( name );
+        if ( it == features.end() ) {
+            return false;
+        }
+        x.push_back( it->second );
+    }
+    return true;
+}
@@ -42,6 +42,7 @@
 #include <algorithm>
 
 #include "../XML/ParameterGroup.h"
+#include "SurrogateModel.h"
 #include "Constants.h"
 #include "VieVS_Object.h"
 #include "WeightFactors.h"
@@ -141,6 +142,16 @@ class MultiScheduling : public VieVS_Object {
          */
         Parameters( const std::vector<Parameters> &v, double mutation, double minMutation );
 
+        /**
+         * @brief constructor based on property tree
+         * @author Matthias Schartner
+         *
+         * counterpart of toPropertyTree()
+         *
+         * @param tree property tree
+         */
+        explicit Parameters( const boost::property_tree::ptree &tree );
+
         /**
          * @brief normalize weight factors
          * @author Matthias Schartner
@@ -326,9 +337,9 @@ class MultiScheduling : public VieVS_Object {
          * @brief output function to write header to statistics file
          * @author Matthias Schartner
          *
-         * @param of outfile stream object
+         * @param of output stream object
          */
-        void statisticsHeaderOutput( std::ofstream &of ) const {
+        void statisticsHeaderOutput( std::ostream &of ) const {
             if ( start.is_initialized() ) {
                 of << "start,";
             }
@@ -648,6 +659,40 @@ class MultiScheduling : public VieVS_Object {
             }
             return str;
         }
+
+
+        /**
+         * @brief write all parameters to property tree
+         * @author Matthias Schartner
+         *
+         * used to send parameters to other processes. Floating point values are written without loss of precision.
+         *
+         * @return property tree
+         */
+        boost::property_tree::ptree toPropertyTree() const;
+
+
+        /**
+         * @brief all numeric parameter values (except start time)
+         * @author Matthias Schartner
+         *
+         * used as input for the surrogate model. Features are identified by the parameter name, station, source and
+         * baseline parameters by "<parameter name>.<member>".
+         *
+         * @return feature name and value
+         */
+        std::map<std::string, double> toFeatures() const;
+
+
+        /**
+         * @brief parameter values in fixed order
+         * @author Matthias Schartner
+         *
+         * @param layout feature names (see toFeatures())
+         * @param x feature vector (one element per entry of layout)
+         * @return false if a feature of the layout is not set
+         */
+        bool toFeatureVector( const std::vector<std::string> &layout, std::vector<double> &x ) const;
     };
 
 
@@ -728,6 +773,8 @@ class MultiScheduling : public VieVS_Object {
      * @brief generate new population of multi-scheduling parameters
      * @author Matthias Schartner
      *
+     * random numbers are drawn from an independent stream per generation (derived from the multi scheduling seed)
+     *
      * @param gen generation number
      * @param old_pop old populatoin of parameters
      * @param scores score of each parameter
@@ -753,7 +800,21 @@ class MultiScheduling : public VieVS_Object {
      *
      * @param seed seed
      */
-    static void setSeed( unsigned int seed ) { random_engine_ = std::default_random_engine( seed ); }
+    static void setSeed( unsigned int seed ) {
+        seed_ = seed;
+        random_engine_ = std::default_random_engine( seed );
+    }
+
+    /**
+     * @brief get seed for RNG generator
+     * @author Matthias Schartner
+     *
+     * every evolution step draws from its own stream derived from this seed, it is sufficient to continue the
+     * evolution of a restarted multi scheduling run exactly
+     *
+     * @return seed
+     */
+    static unsigned int getSeed() { return seed_; }
 
     /**
      * @brief set pick random values
@@ -766,6 +827,7 @@ class MultiScheduling : public VieVS_Object {
 
    private:
     static unsigned long nextId;                       ///< next id
+    static unsigned int seed_;                         ///< seed of random number generator engine
     static std::default_random_engine random_engine_;  ///< random number generator engine
     static bool pick_random;
     static unsigned long nsta_;
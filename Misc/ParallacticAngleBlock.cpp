@@ -7,10 +7,10 @@
 using namespace std;
 using namespace VieVS;
 
-string ParallacticAngleBlock::intent_;
-double ParallacticAngleBlock::distanceScaling = 10.0;
-int ParallacticAngleBlock::cadence = 600;
-unsigned int ParallacticAngleBlock::duration = 300;
-int ParallacticAngleBlock::nscans = 0;
-vector<unsigned long> ParallacticAngleBlock::allowedSources = vector<unsigned long>();
-vector<unsigned long> ParallacticAngleBlock::allowedStations = vector<unsigned long>();
+thread_local SessionParameter<string> ParallacticAngleBlock::intent_;
+thread_local SessionParameter<double> ParallacticAngleBlock::distanceScaling = 10.0;
+thread_local SessionParameter<int> ParallacticAngleBlock::cadence = 600;
+thread_local SessionParameter<unsigned int> ParallacticAngleBlock::duration = 300;
+thread_local SessionParameter<int> ParallacticAngleBlock::nscans = 0;
+thread_local SessionParameter<vector<unsigned long>> ParallacticAngleBlock::allowedSources = vector<unsigned long>();
+thread_local SessionParameter<vector<unsigned long>> ParallacticAngleBlock::allowedStations = vector<unsigned long>();
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <vector>
 
+#include "SessionParameter.h"
 #include "VieVS_Object.h"
 
 namespace VieVS {
@@ -21,13 +22,13 @@ namespace VieVS {
 
 class ParallacticAngleBlock : public VieVS_Object {
    public:
-    static std::string intent_;
-    static int cadence;
-    static double distanceScaling;
-    static std::vector<unsigned long> allowedSources;
-    static std::vector<unsigned long> allowedStations;
-    static unsigned int duration;
-    static int nscans;
+    static thread_local SessionParameter<std::string> intent_;
+    static thread_local SessionParameter<int> cadence;
+    static thread_local SessionParameter<double> distanceScaling;
+    static thread_local SessionParameter<std::vector<unsigned long>> allowedSources;
+    static thread_local SessionParameter<std::vector<unsigned long>> allowedStations;
+    static thread_local SessionParameter<unsigned int> duration;
+    static thread_local SessionParameter<int> nscans;
 
     static bool isAllowedSource( unsigned long srcid ) {
         return find( allowedSources.begin(), allowedSources.end(), srcid ) != allowedSources.end();
@@ -0,0 +1,318 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SchedulingContext.h"
+
+#include "../Algorithm/FocusCorners.h"
+#include "AstrometricCalibratorBlock.h"
+#include "AstronomicalParameters.h"
+#include "AvoidSatellites.h"
+#include "CalibratorBlock.h"
+#include "DifferentialParallacticAngleBlock.h"
+#include "Flags.h"
+#include "ParallacticAngleBlock.h"
+#include "WeightFactors.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+/**
+ * @brief session parameters of one thread
+ * @author Matthias Schartner
+ */
+struct SchedulingContext::Parameters {
+    // Flags
+    SessionParameter<bool> logTrace = Flags::logTrace;
+    SessionParameter<bool> logDebug = Flags::logDebug;
+
+    // TimeSystem
+    SessionParameter<double> mjdStart = TimeSystem::mjdStart;
+    SessionParameter<boost::posix_time::ptime> startTime = TimeSystem::startTime;
+    SessionParameter<boost::posix_time::ptime> endTime = TimeSystem::endTime;
+    SessionParameter<unsigned int> duration = TimeSystem::duration;
+    SessionParameter<DateTime> startSgp4 = TimeSystem::startSgp4;
+
+    // AstronomicalParameters
+    SessionParameter<vector<double>> earth_velocity = AstronomicalParameters::earth_velocity;
+    SessionParameter<vector<double>> earth_nutX = AstronomicalParameters::earth_nutX;
+    SessionParameter<vector<double>> earth_nutY = AstronomicalParameters::earth_nutY;
+    SessionParameter<vector<double>> earth_nutS = AstronomicalParameters::earth_nutS;
+    SessionParameter<vector<unsigned int>> earth_nutTime = AstronomicalParameters::earth_nutTime;
+    SessionParameter<vector<double>> sun_ra = AstronomicalParameters::sun_ra;
+    SessionParameter<vector<double>> sun_dec = AstronomicalParameters::sun_dec;
+    SessionParameter<vector<unsigned int>> sun_time = AstronomicalParameters::sun_time;
+
+    // ObservingMode
+    SessionParameter<ObservingMode::Type> modeType = ObservingMode::type;
+    SessionParameter<unordered_map<string, double>> modeMinSNR = ObservingMode::minSNR;
+    SessionParameter<unordered_map<string, ObservingMode::Property>> stationProperty = ObservingMode::stationProperty;
+    SessionParameter<unordered_map<string, ObservingMode::Backup>> stationBackup = ObservingMode::stationBackup;
+    SessionParameter<unordered_map<string, double>> stationBackupValue = ObservingMode::stationBackupValue;
+    SessionParameter<unordered_map<string, ObservingMode::Property>> sourceProperty = ObservingMode::sourceProperty;
+    SessionParameter<unordered_map<string, ObservingMode::Backup>> sourceBackup = ObservingMode::sourceBackup;
+    SessionParameter<unordered_map<string, double>> sourceBackupValue = ObservingMode::sourceBackupValue;
+    SessionParameter<set<string>> bands = ObservingMode::bands;
+    SessionParameter<unordered_map<string, double>> wavelengths = ObservingMode::wavelengths;
+
+    // AvoidSatellites
+    SessionParameter<vector<shared_ptr<Satellite>>> satellitesToAvoid = AvoidSatellites::satellitesToAvoid;
+    SessionParameter<double> satExtraMargin = AvoidSatellites::extraMargin;
+    SessionParameter<double> satOrbitError = AvoidSatellites::orbitError;
+    SessionParameter<double> satOrbitErrorPerDay = AvoidSatellites::orbitErrorPerDay;
+    SessionParameter<double> satMinElevation = AvoidSatellites::minElevation;
+    SessionParameter<int> satFrequency = AvoidSatellites::frequency;
+    SessionParameter<double> satOutputPercentage = AvoidSatellites::outputPercentage;
+    SessionParameter<unordered_map<int, unordered_map<int, vector<pair<int, int>>>>> satVisible =
+        AvoidSatellites::visible_;
+
+    // CalibratorBlock
+    SessionParameter<string> calIntent = CalibratorBlock::intent_;
+    SessionParameter<bool> calTryToIncludeAllStationFlag = CalibratorBlock::tryToIncludeAllStationFlag;
+    SessionParameter<bool> calSubnetting = CalibratorBlock::subnetting;
+    SessionParameter<double> calTryToIncludeAllStations_factor = CalibratorBlock::tryToIncludeAllStations_factor;
+    SessionParameter<double> calNumberOfObservations_factor = CalibratorBlock::numberOfObservations_factor;
+    SessionParameter<double> calNumberOfObservations_offset = CalibratorBlock::numberOfObservations_offset;
+    SessionParameter<double> calAverageStations_factor = CalibratorBlock::averageStations_factor;
+    SessionParameter<double> calAverageStations_offset = CalibratorBlock::averageStations_offset;
+    SessionParameter<double> calDuration_factor = CalibratorBlock::duration_factor;
+    SessionParameter<double> calDuration_offset = CalibratorBlock::duration_offset;
+    SessionParameter<double> calAverageBaseline_factor = CalibratorBlock::averageBaseline_factor;
+    SessionParameter<double> calAverageBaseline_offset = CalibratorBlock::averageBaseline_offset;
+
+    // AstrometricCalibratorBlock
+    SessionParameter<bool> astScheduleCalibrationBlocks = AstrometricCalibratorBlock::scheduleCalibrationBlocks;
+    SessionParameter<unsigned int> astCadence = AstrometricCalibratorBlock::cadence;
+    SessionParameter<AstrometricCalibratorBlock::CadenceUnit> astCadenceUnit = AstrometricCalibratorBlock::cadenceUnit;
+    SessionParameter<vector<unsigned long>> astCalibratorSourceIds = AstrometricCalibratorBlock::calibratorSourceIds;
+    SessionParameter<unsigned int> astNmaxScans = AstrometricCalibratorBlock::nmaxScans;
+    SessionParameter<AstrometricCalibratorBlock::TargetScanLengthType> astTargetScanLengthType =
+        AstrometricCalibratorBlock::targetScanLengthType;
+    SessionParameter<unordered_map<string, double>> astMinSNR = AstrometricCalibratorBlock::minSNR;
+    SessionParameter<unsigned int> astScanLength = AstrometricCalibratorBlock::scanLength;
+    SessionParameter<double> astLowElevationStartWeight = AstrometricCalibratorBlock::lowElevationStartWeight;
+    SessionParameter<double> astLowElevationFullWeight = AstrometricCalibratorBlock::lowElevationFullWeight;
+    SessionParameter<double> astHighElevationStartWeight = AstrometricCalibratorBlock::highElevationStartWeight;
+    SessionParameter<double> astHighElevationFullWeight = AstrometricCalibratorBlock::highElevationFullWeight;
+
+    // ParallacticAngleBlock
+    SessionParameter<string> paIntent = ParallacticAngleBlock::intent_;
+    SessionParameter<int> paCadence = ParallacticAngleBlock::cadence;
+    SessionParameter<double> paDistanceScaling = ParallacticAngleBlock::distanceScaling;
+    SessionParameter<vector<unsigned long>> paAllowedSources = ParallacticAngleBlock::allowedSources;
+    SessionParameter<vector<unsigned long>> paAllowedStations = ParallacticAngleBlock::allowedStations;
+    SessionParameter<unsigned int> paDuration = ParallacticAngleBlock::duration;
+    SessionParameter<int> paNscans = ParallacticAngleBlock::nscans;
+
+    // DifferentialParallacticAngleBlock
+    SessionParameter<string> dpaIntent = DifferentialParallacticAngleBlock::intent_;
+    SessionParameter<int> dpaCadence = DifferentialParallacticAngleBlock::cadence;
+    SessionParameter<double> dpaDistanceScaling = DifferentialParallacticAngleBlock::distanceScaling;
+    SessionParameter<vector<unsigned long>> dpaAllowedSources = DifferentialParallacticAngleBlock::allowedSources;
+    SessionParameter<vector<unsigned long>> dpaAllowedBaseline = DifferentialParallacticAngleBlock::allowedBaseline;
+    SessionParameter<unsigned int> dpaDuration = DifferentialParallacticAngleBlock::duration;
+    SessionParameter<int> dpaNscans = DifferentialParallacticAngleBlock::nscans;
+    SessionParameter<vector<double>> dpaAngles = DifferentialParallacticAngleBlock::angles;
+
+    // FocusCorners, Scan, ScanTimes and Network
+    SessionParameter<bool> focusFlag = FocusCorners::flag;
+    SessionParameter<int> focusNscans = FocusCorners::nscans;
+    SessionParameter<unsigned int> focusInterval = FocusCorners::interval;
+    SessionParameter<bool> scanSequenceFlag = Scan::scanSequence_flag;
+    SessionParameter<map<unsigned int, vector<unsigned long>>> scanSequenceTarget = Scan::scanSequence_target;
+    ScanTimes::AlignmentAnchor anchor = ScanTimes::getAlignmentAnchor();
+    map<unsigned long, int> station2site = Network::stations2sites();
+
+    // WeightFactors
+    SessionParameter<double> weightSkyCoverage = WeightFactors::weightSkyCoverage;
+    SessionParameter<double> weightNumberOfObservations = WeightFactors::weightNumberOfObservations;
+    SessionParameter<double> weightDuration = WeightFactors::weightDuration;
+    SessionParameter<double> weightAverageSources = WeightFactors::weightAverageSources;
+    SessionParameter<double> weightAverageStations = WeightFactors::weightAverageStations;
+    SessionParameter<double> weightAverageBaselines = WeightFactors::weightAverageBaselines;
+    SessionParameter<double> weightIdleTime = WeightFactors::weightIdleTime;
+    SessionParameter<unsigned int> idleTimeInterval = WeightFactors::idleTimeInterval;
+    SessionParameter<double> weightClosures = WeightFactors::weightClosures;
+    SessionParameter<unsigned int> maxClosures = WeightFactors::maxClosures;
+    SessionParameter<double> weightDeclination = WeightFactors::weightDeclination;
+    SessionParameter<double> declinationStartWeight = WeightFactors::declinationStartWeight;
+    SessionParameter<double> declinationFullWeight = WeightFactors::declinationFullWeight;
+    SessionParameter<double> weightLowElevation = WeightFactors::weightLowElevation;
+    SessionParameter<double> lowElevationStartWeight = WeightFactors::lowElevationStartWeight;
+    SessionParameter<double> lowElevationFullWeight = WeightFactors::lowElevationFullWeight;
+
+    // calibrator and parallactic angle blocks
+    SessionParameter<int> stationOverlap = CalibratorBlock::stationOverlap;
+    SessionParameter<bool> rigorosStationOverlap = CalibratorBlock::rigorosStationOverlap;
+    SessionParameter<vector<int>> stationFlag = CalibratorBlock::stationFlag;
+    SessionParameter<unsigned int> nextBlock = AstrometricCalibratorBlock::nextBlock;
+    SessionParameter<int> diffParallacticAngleScan = DifferentialParallacticAngleBlock::iScan;
+
+    // Scan
+    SessionParameter<unsigned int> nScanSelections = Scan::nScanSelections;
+    SessionParameter<unsigned int> scanSequenceModulo = Scan::scanSequence_modulo;
+
+    // FocusCorners
+    SessionParameter<int> focusIscan = FocusCorners::iscan;
+    SessionParameter<bool> startFocusCorner = FocusCorners::startFocusCorner;
+    SessionParameter<unsigned int> focusNextStart = FocusCorners::nextStart;
+    SessionParameter<vector<double>> lastCornerAzimuth = FocusCorners::lastCornerAzimuth;
+    SessionParameter<vector<pair<int, double>>> backupWeight = FocusCorners::backupWeight;
+    SessionParameter<vector<int>> staid2groupid = FocusCorners::staid2groupid;
+
+
+    /**
+     * @brief set values on calling thread
+     * @author Matthias Schartner
+     */
+    void apply() const {
+        Flags::logTrace = logTrace;
+        Flags::logDebug = logDebug;
+
+        TimeSystem::mjdStart = mjdStart;
+        TimeSystem::startTime = startTime;
+        TimeSystem::endTime = endTime;
+        TimeSystem::duration = duration;
+        TimeSystem::startSgp4 = startSgp4;
+
+        AstronomicalParameters::earth_velocity = earth_velocity;
+        AstronomicalParameters::earth_nutX = earth_nutX;
+        AstronomicalParameters::earth_nutY = earth_nutY;
+        AstronomicalParameters::earth_nutS = earth_nutS;
+        AstronomicalParameters::earth_nutTime = earth_nutTime;
+        AstronomicalParameters::sun_ra = sun_ra;
+        AstronomicalParameters::sun_dec = sun_dec;
+        AstronomicalParameters::sun_time = sun_time;
+
+        ObservingMode::type = modeType;
+        ObservingMode::minSNR = modeMinSNR;
+        ObservingMode::stationProperty = stationProperty;
+        ObservingMode::stationBackup = stationBackup;
+        ObservingMode::stationBackupValue = stationBackupValue;
+        ObservingMode::sourceProperty = sourceProperty;
+        ObservingMode::sourceBackup = sourceBackup;
+        ObservingMode::sourceBackupValue = sourceBackupValue;
+        ObservingMode::bands = bands;
+        ObservingMode::wavelengths = wavelengths;
+
+        AvoidSatellites::satellitesToAvoid = satellitesToAvoid;
+        AvoidSatellites::extraMargin = satExtraMargin;
+        AvoidSatellites::orbitError = satOrbitError;
+        AvoidSatellites::orbitErrorPerDay = satOrbitErrorPerDay;
+        AvoidSatellites::minElevation = satMinElevation;
+        AvoidSatellites::frequency = satFrequency;
+        AvoidSatellites::outputPercentage = satOutputPercentage;
+        AvoidSatellites::visible_ = satVisible;
+
+        CalibratorBlock::intent_ = calIntent;
+        CalibratorBlock::tryToIncludeAllStationFlag = calTryToIncludeAllStationFlag;
+        CalibratorBlock::subnetting = calSubnetting;
+        CalibratorBlock::tryToIncludeAllStations_factor = calTryToIncludeAllStations_factor;
+        CalibratorBlock::numberOfObservations_factor = calNumberOfObservations_factor;
+        CalibratorBlock::numberOfObservations_offset = calNumberOfObservations_offset;
+        CalibratorBlock::averageStations_factor = calAverageStations_factor;
+        CalibratorBlock::averageStations_offset = calAverageStations_offset;
+        CalibratorBlock::duration_factor = calDuration_factor;
+        CalibratorBlock::duration_offset = calDuration_offset;
+        CalibratorBlock::averageBaseline_factor = calAverageBaseline_factor;
+        CalibratorBlock::averageBaseline_offset = calAverageBaseline_offset;
+
+        AstrometricCalibratorBlock::scheduleCalibrationBlocks = astScheduleCalibrationBlocks;
+        AstrometricCalibratorBlock::cadence = astCadence;
+        AstrometricCalibratorBlock::cadenceUnit = astCadenceUnit;
+        AstrometricCalibratorBlock::calibratorSourceIds = astCalibratorSourceIds;
+        AstrometricCalibratorBlock::nmaxScans = astNmaxScans;
+        AstrometricCalibratorBlock::targetScanLengthType = astTargetScanLengthType;
+        AstrometricCalibratorBlock::minSNR = astMinSNR;
+        AstrometricCalibratorBlock::scanLength = astScanLength;
+        AstrometricCalibratorBlock::lowElevationStartWeight = astLowElevationStartWeight;
+        AstrometricCalibratorBlock::lowElevationFullWeight = astLowElevationFullWeight;
+        AstrometricCalibratorBlock::highElevationStartWeight = astHighElevationStartWeight;
+        AstrometricCalibratorBlock::highElevationFullWeight = astHighElevationFullWeight;
+
+        ParallacticAngleBlock::intent_ = paIntent;
+        ParallacticAngleBlock::cadence = paCadence;
+        ParallacticAngleBlock::distanceScaling = paDistanceScaling;
+        ParallacticAngleBlock::allowedSources = paAllowedSources;
+        ParallacticAngleBlock::allowedStations = paAllowedStations;
+        ParallacticAngleBlock::duration = paDuration;
+        ParallacticAngleBlock::nscans = paNscans;
+
+        DifferentialParallacticAngleBlock::intent_ = dpaIntent;
+        DifferentialParallacticAngleBlock::cadence = dpaCadence;
+        DifferentialParallacticAngleBlock::distanceScaling = dpaDistanceScaling;
+        DifferentialParallacticAngleBlock::allowedSources = dpaAllowedSources;
+        DifferentialParallacticAngleBlock::allowedBaseline = dpaAllowedBaseline;
+        DifferentialParallacticAngleBlock::duration = dpaDuration;
+        DifferentialParallacticAngleBlock::nscans = dpaNscans;
+        DifferentialParallacticAngleBlock::angles = dpaAngles;
+
+        FocusCorners::flag = focusFlag;
+        FocusCorners::nscans = focusNscans;
+        FocusCorners::interval = focusInterval;
+        Scan::scanSequence_flag = scanSequenceFlag;
+        Scan::scanSequence_target = scanSequenceTarget;
+        ScanTimes::setAlignmentAnchor( anchor );
+        Network::addSites( station2site );
+
+        WeightFactors::weightSkyCoverage = weightSkyCoverage;
+        WeightFactors::weightNumberOfObservations = weightNumberOfObservations;
+        WeightFactors::weightDuration = weightDuration;
+        WeightFactors::weightAverageSources = weightAverageSources;
+        WeightFactors::weightAverageStations = weightAverageStations;
+        WeightFactors::weightAverageBaselines = weightAverageBaselines;
+        WeightFactors::weightIdleTime = weightIdleTime;
+        WeightFactors::idleTimeInterval = idleTimeInterval;
+        WeightFactors::weightClosures = weightClosures;
+        WeightFactors::maxClosures = maxClosures;
+        WeightFactors::weightDeclination = weightDeclination;
+        WeightFactors::declinationStartWeight = declinationStartWeight;
+        WeightFactors::declinationFullWeight = declinationFullWeight;
+        WeightFactors::weightLowElevation = weightLowElevation;
+        WeightFactors::lowElevationStartWeight = lowElevationStartWeight;
+        WeightFactors::lowElevationFullWeight = lowElevationFullWeight;
+
+        CalibratorBlock::stationOverlap = stationOverlap;
+        CalibratorBlock::rigorosStationOverlap = rigorosStationOverlap;
+        CalibratorBlock::stationFlag = stationFlag;
+        AstrometricCalibratorBlock::nextBlock = nextBlock;
+        DifferentialParallacticAngleBlock::iScan = diffParallacticAngleScan;
+
+        Scan::nScanSelections = nScanSelections;
+        Scan::scanSequence_modulo = scanSequenceModulo;
+
+        FocusCorners::iscan = focusIscan;
+        FocusCorners::startFocusCorner = startFocusCorner;
+        FocusCorners::nextStart = focusNextStart;
+        FocusCorners::lastCornerAzimuth = lastCornerAzimuth;
+        FocusCorners::backupWeight = backupWeight;
+        FocusCorners::staid2groupid = staid2groupid;
+    }
+};
+
+
+SchedulingContext SchedulingContext::capture() {
+    SessionBinding::check();
+    return SchedulingContext( make_shared<const Parameters>() );
+}
+
+
+void SchedulingContext::apply() const {
+    parameters_->apply();
+    SessionBinding::bound_ = true;
+}
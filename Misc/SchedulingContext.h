@@ -0,0 +1,127 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SchedulingContext.h
+ * @brief class SchedulingContext
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+
+#ifndef VIESCHEDPP_SCHEDULINGCONTEXT_H
+#define VIESCHEDPP_SCHEDULINGCONTEXT_H
+
+
+#include <memory>
+
+#include "SessionParameter.h"
+
+
+namespace VieVS {
+
+/**
+ * @class SchedulingContext
+ * @brief snapshot of all session parameters of one thread
+ *
+ * Session parameters (time system, observing mode, block definitions, weight factors, ...) are thread local static
+ * members of the corresponding classes (see SessionParameter). A context captures the values of the calling thread
+ * and sets them on another thread. Only the thread which starts the program holds valid session parameters, every
+ * other thread has to apply a context first (use a Scope), otherwise reading a session parameter throws.
+ *
+ * Large parameters (nutation tables, satellite visibility, ...) are shared between the threads and all captured
+ * contexts. Capturing and applying a context does therefore not copy them.
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+class SchedulingContext {
+   public:
+    /**
+     * @class Scope
+     * @brief applies a context on the calling thread for the lifetime of this object
+     *
+     * Afterwards, the thread is bound as before (e.g. OpenMP threads which are reused for other work are unbound
+     * again). The parameter values are not restored.
+     *
+     * @author Matthias Schartner
+     * @date 17.10.2026
+     */
+    class Scope {
+       public:
+        /**
+         * @brief constructor
+         * @author Matthias Schartner
+         *
+         * @param context context applied on calling thread
+         */
+        explicit Scope( const SchedulingContext &context ) : wasBound_{ SessionBinding::isBound() } {
+            context.apply();
+        }
+
+        Scope( const Scope & ) = delete;
+
+        Scope &operator=( const Scope & ) = delete;
+
+        /**
+         * @brief destructor
+         * @author Matthias Schartner
+         */
+        ~Scope() { SessionBinding::bound_ = wasBound_; }
+
+       private:
+        bool wasBound_;  ///< thread was bound before
+    };
+
+
+    /**
+     * @brief capture all parameters of calling thread
+     * @author Matthias Schartner
+     *
+     * @return context
+     */
+    static SchedulingContext capture();
+
+
+    /**
+     * @brief set all parameters on calling thread
+     * @author Matthias Schartner
+     *
+     * The thread stays bound to these parameters. Use a Scope on threads which are used for other work afterwards.
+     */
+    void apply() const;
+
+   private:
+    struct Parameters;
+
+    std::shared_ptr<const Parameters> parameters_;  ///< captured session parameters
+
+
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * @param parameters captured session parameters
+     */
+    explicit SchedulingContext( std::shared_ptr<const Parameters> parameters )
+        : parameters_{ std::move( parameters ) } {}
+};
+
+}  // namespace VieVS
+
+#endif  // VIESCHEDPP_SCHEDULINGCONTEXT_H
@@ -0,0 +1,35 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SessionParameter.h"
+
+#include <stdexcept>
+
+
+using namespace std;
+using namespace VieVS;
+
+thread_local bool SessionBinding::bound_ = false;
+
+// static initialization runs on the thread which starts the program
+const bool SessionBinding::mainThread_ = ( SessionBinding::bound_ = true );
+
+
+void SessionBinding::unbound() {
+    throw logic_error( "session parameters read on a thread without scheduling context" );
+}
@@ -0,0 +1,256 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SessionParameter.h
+ * @brief class SessionParameter
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+
+#ifndef VIESCHEDPP_SESSIONPARAMETER_H
+#define VIESCHEDPP_SESSIONPARAMETER_H
+
+
+#include <memory>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+
+namespace VieVS {
+
+/**
+ * @class SessionBinding
+ * @brief flag if session parameters are valid on the calling thread
+ *
+ * The thread which starts the program sets up the session parameters and is always bound. All other threads are
+ * bound while a SchedulingContext is applied (see SchedulingContext::Scope). Reading a session parameter on an unbound
+ * thread throws a std::logic_error instead of silently returning default values.
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+class SessionBinding {
+    friend class SchedulingContext;
+
+   public:
+    /**
+     * @brief check if calling thread is bound
+     * @author Matthias Schartner
+     *
+     * @return true if session parameters can be read
+     */
+    static bool isBound() noexcept { return bound_; }
+
+
+    /**
+     * @brief throw if calling thread is not bound
+     * @author Matthias Schartner
+     */
+    static void check() {
+        if ( !bound_ ) {
+            unbound();
+        }
+    }
+
+   private:
+    static thread_local bool bound_;  ///< session parameters of this thread are valid
+    static const bool mainThread_;    ///< binds the thread which starts the program
+
+
+    /**
+     * @brief throw std::logic_error
+     * @author Matthias Schartner
+     */
+    [[noreturn]] static void unbound();
+};
+
+
+/**
+ * @brief true for associative containers with a mapped_type (std::map, std::unordered_map)
+ */
+template <typename T, typename = void>
+struct hasMappedType : std::false_type {};
+
+template <typename T>
+struct hasMappedType<T, std::void_t<typename T::mapped_type>> : std::true_type {};
+
+
+/**
+ * @class SessionParameter
+ * @brief session wide parameter of one thread
+ *
+ * Replaces a static member of type T. Reading the value checks that the calling thread is bound to a session. Numbers
+ * and enums are stored by value. All other types are stored in a shared buffer, copying the parameter (e.g. to capture
+ * or apply a SchedulingContext) does not copy the data. The data is only copied if it is modified while it is shared.
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+template <typename T, bool byValue = std::is_arithmetic<T>::value || std::is_enum<T>::value>
+class SessionParameter;
+
+
+/**
+ * @brief session parameter stored by value
+ * @author Matthias Schartner
+ */
+template <typename T>
+class SessionParameter<T, true> {
+   public:
+    constexpr SessionParameter( T value = T() ) noexcept : value_{ value } {}
+
+    SessionParameter &operator=( T value ) noexcept {
+        value_ = value;
+        return *this;
+    }
+
+    const T &get() const {
+        SessionBinding::check();
+        return value_;
+    }
+
+    operator T() const { return get(); }
+
+    SessionParameter &operator++() {
+        SessionBinding::check();
+        ++value_;
+        return *this;
+    }
+
+    T operator++( int ) {
+        SessionBinding::check();
+        return value_++;
+    }
+
+    SessionParameter &operator--() {
+        SessionBinding::check();
+        --value_;
+        return *this;
+    }
+
+    SessionParameter &operator+=( T value ) {
+        SessionBinding::check();
+        value_ += value;
+        return *this;
+    }
+
+    SessionParameter &operator-=( T value ) {
+        SessionBinding::check();
+        value_ -= value;
+        return *this;
+    }
+
+   private:
+    T value_;  ///< value
+};
+
+
+/**
+ * @brief session parameter stored in shared buffer
+ * @author Matthias Schartner
+ */
+template <typename T>
+class SessionParameter<T, false> {
+   public:
+    SessionParameter() : value_{ std::make_shared<T>() } {}
+
+    SessionParameter( T value ) : value_{ std::make_shared<T>( std::move( value ) ) } {}
+
+    SessionParameter &operator=( T value ) {
+        value_ = std::make_shared<T>( std::move( value ) );
+        return *this;
+    }
+
+    const T &get() const {
+        SessionBinding::check();
+        return *value_;
+    }
+
+    operator const T &() const { return get(); }
+
+    const T *operator->() const { return &get(); }
+
+    /**
+     * @brief modifiable value (copied first if it is shared with a SchedulingContext)
+     * @author Matthias Schartner
+     *
+     * @return value
+     */
+    T &edit() {
+        SessionBinding::check();
+        if ( value_.use_count() > 1 ) {
+            value_ = std::make_shared<T>( *value_ );
+        }
+        return *value_;
+    }
+
+    auto begin() const { return get().begin(); }
+
+    auto end() const { return get().end(); }
+
+    auto size() const { return get().size(); }
+
+    bool empty() const { return get().empty(); }
+
+    /**
+     * @brief read-only element access
+     *
+     * For maps a missing key yields a default constructed value instead of inserting it; use edit() to insert.
+     */
+    template <typename Key>
+    decltype( auto ) operator[]( const Key &key ) const {
+        if constexpr ( hasMappedType<T>::value ) {
+            static const typename T::mapped_type missing{};
+            auto it = get().find( key );
+            return it != get().end() ? it->second : missing;
+        } else {
+            return get()[key];
+        }
+    }
+
+    template <typename Key>
+    decltype( auto ) at( const Key &key ) const {
+        return get().at( key );
+    }
+
+    template <typename Key>
+    auto find( const Key &key ) const {
+        return get().find( key );
+    }
+
+    template <typename Key>
+    auto count( const Key &key ) const {
+        return get().count( key );
+    }
+
+   private:
+    std::shared_ptr<T> value_;  ///< value (shared with captured contexts)
+};
+
+
+template <typename T, bool byValue>
+std::ostream &operator<<( std::ostream &out, const SessionParameter<T, byValue> &parameter ) {
+    return out << parameter.get();
+}
+
+}  // namespace VieVS
+
+#endif  // VIESCHEDPP_SESSIONPARAMETER_H
@@ -28,6 +28,7 @@
 #define SUBNETTING_H
 
 
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -48,7 +49,7 @@ class Subnetting {
      *
      * @param subnettingSrcIds list of possible subnetting source ids
      */
-    explicit Subnetting( std::vector<std::vector<unsigned long>> subnettingSrcIds )
+    explicit Subnetting( std::shared_ptr<const std::vector<std::vector<unsigned long>>> subnettingSrcIds )
         : subnettingSrcIds{ std::move( subnettingSrcIds ) } {
 
           };
@@ -71,7 +72,25 @@ class Subnetting {
      *
      * @return list of possible subnetting source ids
      */
-    const std::vector<std::vector<unsigned long>> &getSubnettingSrcIds() const { return subnettingSrcIds; }
+    const std::vector<std::vector<unsigned long>> &getSubnettingSrcIds() const { return *subnettingSrcIds; }
+
+
+    /**
+     * @brief set maximum number of station splits per source pair
+     * @author Matthias Schartner
+     *
+     * @param maxSplits maximum number of splits with the most observations (0 = all splits)
+     */
+    void setMaxSplits( unsigned long maxSplits ) { maxSplits_ = maxSplits; }
+
+
+    /**
+     * @brief maximum number of station splits per source pair
+     * @author Matthias Schartner
+     *
+     * @return maximum number of splits (0 = all splits)
+     */
+    unsigned long getMaxSplits() const { return maxSplits_; }
 
 
    private:
@@ -86,7 +105,9 @@ class Subnetting {
     virtual bool allowedMinSta( unsigned long nsta, unsigned long nsta_max ) = 0;
 
 
-    std::vector<std::vector<unsigned long>> subnettingSrcIds;  ///< list of possible subnetting source ids
+    std::shared_ptr<const std::vector<std::vector<unsigned long>>>
+        subnettingSrcIds;          ///< list of possible subnetting source ids (shared between schedules)
+    unsigned long maxSplits_ = 0;  ///< maximum number of station splits per source pair
 };
 
 
@@ -106,7 +127,8 @@ class Subnetting_percent : public Subnetting {
      * @param subnettingSrcIds list of possible subnetting source ids
      * @param percent minimum necessary percentage of stations (e.g.: = 0.8)
      */
-    explicit Subnetting_percent( std::vector<std::vector<unsigned long>> subnettingSrcIds, double percent )
+    explicit Subnetting_percent( std::shared_ptr<const std::vector<std::vector<unsigned long>>> subnettingSrcIds,
+                                 double percent )
         : Subnetting( std::move( subnettingSrcIds ) ), percent_{ percent } {}
 
 
@@ -142,7 +164,8 @@ class Subnetting_minIdle : public Subnetting {
      * @param subnettingSrcIds list of possible subnetting source ids
      * @param maxIdle maximum allowed number of idle stations
      */
-    explicit Subnetting_minIdle( std::vector<std::vector<unsigned long>> subnettingSrcIds, int maxIdle )
+    explicit Subnetting_minIdle( std::shared_ptr<const std::vector<std::vector<unsigned long>>> subnettingSrcIds,
+                                 int maxIdle )
         : Subnetting( std::move( subnettingSrcIds ) ), maxIdle_{ maxIdle } {}
 
 
@@ -0,0 +1,109 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SurrogateModel.h"
+
+#include <algorithm>
+
+
+using namespace std;
+using namespace VieVS;
+
+
+bool SurrogateModel::fit( const std::vector<std::vector<double>> &x, const std::vector<double> &y, double noise ) {
+    auto n = static_cast<long>( x.size() );
+    if ( n < 2 || y.size() != x.size() ) {
+        return false;
+    }
+    auto d = static_cast<long>( x[0].size() );
+    if ( d == 0 ) {
+        return false;
+    }
+
+    // standardize features
+    Eigen::MatrixXd raw( n, d );
+    for ( long i = 0; i < n; ++i ) {
+        if ( static_cast<long>( x[i].size() ) != d ) {
+            return false;
+        }
+        raw.row( i ) = Eigen::Map<const Eigen::RowVectorXd>( x[i].data(), d );
+    }
+    xMean_ = raw.colwise().mean();
+    xScale_ = ( ( raw.rowwise() - xMean_ ).array().square().colwise().sum() / n ).sqrt();
+    for ( long j = 0; j < d; ++j ) {
+        // constant features do not contribute
+        if ( xScale_( j ) < 1e-12 ) {
+            xScale_( j ) = 1;
+        }
+    }
+    x_ = ( raw.rowwise() - xMean_ ).array().rowwise() / xScale_.array();
+
+    // standardize scores
+    Eigen::VectorXd yy = Eigen::Map<const Eigen::VectorXd>( y.data(), n );
+    yMean_ = yy.mean();
+    yScale_ = sqrt( ( yy.array() - yMean_ ).square().sum() / n );
+    if ( yScale_ < 1e-12 ) {
+        yScale_ = 1;
+    }
+    yy = ( yy.array() - yMean_ ) / yScale_;
+
+    // length scale: median distance between samples
+    vector<double> distances;
+    distances.reserve( n * ( n - 1 ) / 2 );
+    for ( long i = 0; i < n; ++i ) {
+        for ( long j = i + 1; j < n; ++j ) {
+            distances.push_back( ( x_.row( i ) - x_.row( j ) ).norm() );
+        }
+    }
+    auto mid = distances.begin() + distances.size() / 2;
+    nth_element( distances.begin(), mid, distances.end() );
+    lengthScale_ = *mid > 1e-12 ? *mid : 1.0;
+
+    Eigen::MatrixXd k( n, n );
+    for ( long i = 0; i < n; ++i ) {
+        k( i, i ) = 1 + noise;
+        for ( long j = i + 1; j < n; ++j ) {
+            k( i, j ) = kernel( x_.row( i ), x_.row( j ) );
+            k( j, i ) = k( i, j );
+        }
+    }
+    llt_.compute( k );
+    if ( llt_.info() != Eigen::Success ) {
+        return false;
+    }
+    alpha_ = llt_.solve( yy );
+    return true;
+}
+
+
+void SurrogateModel::predict( const std::vector<double> &x, double &mean, double &sigma ) const {
+    Eigen::RowVectorXd xs = standardize( x );
+    Eigen::VectorXd ks( x_.rows() );
+    for ( long i = 0; i < x_.rows(); ++i ) {
+        ks( i ) = kernel( xs, x_.row( i ) );
+    }
+    mean = yMean_ + yScale_ * ks.dot( alpha_ );
+    double variance = 1 - ks.dot( llt_.solve( ks ) );
+    sigma = yScale_ * sqrt( max( variance, 0.0 ) );
+}
+
+
+Eigen::RowVectorXd SurrogateModel::standardize( const std::vector<double> &x ) const {
+    Eigen::RowVectorXd xs = Eigen::Map<const Eigen::RowVectorXd>( x.data(), static_cast<long>( x.size() ) );
+    return ( xs - xMean_ ).array() / xScale_.array();
+}
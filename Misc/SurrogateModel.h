@@ -0,0 +1,107 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SurrogateModel.h
+ * @brief class SurrogateModel
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+
+#ifndef SURROGATEMODEL_H
+#define SURROGATEMODEL_H
+
+
+#include <cmath>
+#include <vector>
+
+#include "../Eigen/Dense"
+
+
+namespace VieVS {
+/**
+ * @class SurrogateModel
+ * @brief Gaussian process regression used to predict the score of multi scheduling parameters
+ *
+ * Features and scores are standardized. A squared exponential kernel is used, its length scale is set to the median
+ * distance between the training samples.
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+class SurrogateModel {
+   public:
+    /**
+     * @brief fit model
+     * @author Matthias Schartner
+     *
+     * @param x feature vector per sample (all of same size)
+     * @param y score per sample
+     * @param noise noise variance relative to score variance
+     * @return false if model could not be fitted
+     */
+    bool fit( const std::vector<std::vector<double>> &x, const std::vector<double> &y, double noise = 0.05 );
+
+
+    /**
+     * @brief predict score
+     * @author Matthias Schartner
+     *
+     * @param x feature vector
+     * @param mean predicted score
+     * @param sigma standard deviation of prediction
+     */
+    void predict( const std::vector<double> &x, double &mean, double &sigma ) const;
+
+   private:
+    Eigen::MatrixXd x_;                ///< standardized training features (one sample per row)
+    Eigen::VectorXd alpha_;            ///< weights of training samples
+    Eigen::LLT<Eigen::MatrixXd> llt_;  ///< decomposition of kernel matrix
+    Eigen::RowVectorXd xMean_;         ///< feature mean
+    Eigen::RowVectorXd xScale_;        ///< feature standard deviation
+    double yMean_ = 0;                 ///< score mean
+    double yScale_ = 1;                ///< score standard deviation
+    double lengthScale_ = 1;           ///< kernel length scale
+
+
+    /**
+     * @brief standardize feature vector
+     * @author Matthias Schartner
+     *
+     * @param x feature vector
+     * @return standardized feature vector
+     */
+    Eigen::RowVectorXd standardize( const std::vector<double> &x ) const;
+
+
+    /**
+     * @brief squared exponential kernel
+     * @author Matthias Schartner
+     *
+     * @param a standardized feature vector
+     * @param b standardized feature vector
+     * @return covariance
+     */
+    double kernel( const Eigen::RowVectorXd &a, const Eigen::RowVectorXd &b ) const {
+        return std::exp( -0.5 * ( a - b ).squaredNorm() / ( lengthScale_ * lengthScale_ ) );
+    }
+};
+}  // namespace VieVS
+
+#endif  // SURROGATEMODEL_H
@@ -19,11 +19,12 @@
 #include "TimeSystem.h"
 
 
-double VieVS::TimeSystem::mjdStart = 0;
-boost::posix_time::ptime VieVS::TimeSystem::startTime = boost::posix_time::ptime();
-boost::posix_time::ptime VieVS::TimeSystem::endTime = boost::posix_time::ptime();
-unsigned int VieVS::TimeSystem::duration = 0;
-DateTime VieVS::TimeSystem::startSgp4 = DateTime( 2000, 1, 1 );
+thread_local VieVS::SessionParameter<double> VieVS::TimeSystem::mjdStart = 0;
+thread_local VieVS::SessionParameter<boost::posix_time::ptime> VieVS::TimeSystem::startTime =
+    boost::posix_time::ptime();
+thread_local VieVS::SessionParameter<boost::posix_time::ptime> VieVS::TimeSystem::endTime = boost::posix_time::ptime();
+thread_local VieVS::SessionParameter<unsigned int> VieVS::TimeSystem::duration = 0;
+thread_local VieVS::SessionParameter<DateTime> VieVS::TimeSystem::startSgp4 = DateTime( 2000, 1, 1 );
 
 
 double VieVS::TimeSystem::mjd2gmst( double mjd ) {
@@ -164,7 +165,7 @@ std::string VieVS::TimeSystem::time2string_doy_units( const boost::posix_time::p
 
 
 boost::posix_time::ptime VieVS::TimeSystem::internalTime2PosixTime( unsigned int time ) {
-    return TimeSystem::startTime + boost::posix_time::seconds( time );
+    return TimeSystem::startTime.get() + boost::posix_time::seconds( time );
 }
 
 
@@ -33,6 +33,7 @@
 
 #include "../SGP4/DateTime.h"
 #include "Constants.h"
+#include "SessionParameter.h"
 #include "util.h"
 
 
@@ -46,11 +47,12 @@ namespace VieVS {
  */
 class TimeSystem {
    public:
-    static double mjdStart;                     ///< modified julian date of session start
-    static boost::posix_time::ptime startTime;  ///< session start time
-    static boost::posix_time::ptime endTime;    ///< session end time
-    static unsigned int duration;               ///< session duration in seconds
-    static DateTime startSgp4;                  ///< session start time in SGP4 format
+    /// modified julian date of session start
+    static thread_local SessionParameter<double> mjdStart;
+    static thread_local SessionParameter<boost::posix_time::ptime> startTime;  ///< session start time
+    static thread_local SessionParameter<boost::posix_time::ptime> endTime;    ///< session end time
+    static thread_local SessionParameter<unsigned int> duration;               ///< session duration in seconds
+    static thread_local SessionParameter<DateTime> startSgp4;                  ///< session start time in SGP4 format
 
     /**
      * @brief transforms modified julian date to Greenwich mean sidereal time
@@ -19,24 +19,24 @@
 #include "WeightFactors.h"
 
 
-double thread_local VieVS::WeightFactors::weightSkyCoverage = 0;
-double thread_local VieVS::WeightFactors::weightNumberOfObservations = 0;
-double thread_local VieVS::WeightFactors::weightDuration = 0;
+thread_local VieVS::SessionParameter<double> VieVS::WeightFactors::weightSkyCoverage = 0;
+thread_local VieVS::SessionParameter<double> VieVS::WeightFactors::weightNumberOfObservations = 0;
+thread_local VieVS::SessionParameter<double> VieVS::WeightFactors::weightDuration = 0;
 
-double thread_local VieVS::WeightFactors::weightAverageSources = 0;
-double thread_local VieVS::WeightFactors::weightAverageStations = 0;
-double thread_local VieVS::WeightFactors::weightAverageBaselines = 0;
+thread_local VieVS::SessionParameter<double> VieVS::WeightFactors::weightAverageSources = 0;
+thread_local VieVS::SessionParameter<double> VieVS::WeightFactors::weightAverageStations = 0;
+thread_local VieVS::SessionParameter<double> VieVS::WeightFactors::weightAverageBaselines = 0;
 
-double thread_local VieVS::WeightFactors::weightIdleTime = 0;
-unsigned int thread_local VieVS::WeightFactors::idleTimeInterval = 0;
+thread_local VieVS::SessionParameter<double> VieVS::WeightFactors::weightIdleTime = 0;
+thread_local VieVS::SessionParameter<unsigned int> VieVS::WeightFactors::idleTimeInterval = 0;
 
-double thread_local VieVS::WeightFactors::weightClosures = 0;
-unsigned int thread_local VieVS::WeightFactors::maxClosures = 0;
+thread_local VieVS::SessionParameter<double> VieVS::WeightFactors::weightClosures = 0;
+thread_local VieVS::SessionParameter<unsigned int> VieVS::WeightFactors::maxClosures = 0;
 
-double thread_local VieVS::WeightFactors::weightDeclination = 0;
-double thread_local VieVS::WeightFactors::declinationStartWeight = 0;
-double thread_local VieVS::WeightFactors::declinationFullWeight = 0;
+thread_local VieVS::SessionParameter<double> VieVS::WeightFactors::weightDeclination = 0;
+thread_local VieVS::SessionParameter<double> VieVS::WeightFactors::declinationStartWeight = 0;
+thread_local VieVS::SessionParameter<double> VieVS::WeightFactors::declinationFullWeight = 0;
 
-double thread_local VieVS::WeightFactors::weightLowElevation = 0;
-double thread_local VieVS::WeightFactors::lowElevationStartWeight = 30;
-double thread_local VieVS::WeightFactors::lowElevationFullWeight = 20;
+thread_local VieVS::SessionParameter<double> VieVS::WeightFactors::weightLowElevation = 0;
+thread_local VieVS::SessionParameter<double> VieVS::WeightFactors::lowElevationStartWeight = 30;
+thread_local VieVS::SessionParameter<double> VieVS::WeightFactors::lowElevationFullWeight = 20;
@@ -33,6 +33,7 @@
 #include <sstream>
 
 #include "Constants.h"
+#include "SessionParameter.h"
 
 
 namespace VieVS {
@@ -45,30 +46,34 @@ namespace VieVS {
  */
 class WeightFactors {
    public:
-    static thread_local double weightSkyCoverage;           ///< weight factor for sky Coverage
-    static thread_local double weightNumberOfObservations;  ///< weight factor for number of observations
-    static thread_local double weightDuration;              ///< weight factor for duration
+    static thread_local SessionParameter<double> weightSkyCoverage;           ///< weight factor for sky Coverage
+    /// weight factor for number of observations
+    static thread_local SessionParameter<double> weightNumberOfObservations;
+    static thread_local SessionParameter<double> weightDuration;              ///< weight factor for duration
 
-    static thread_local double weightAverageSources;    ///< weight factor for average out sources
-    static thread_local double weightAverageStations;   ///< weight factor for average out stations
-    static thread_local double weightAverageBaselines;  ///< weight factor for average out baselines
+    static thread_local SessionParameter<double> weightAverageSources;    ///< weight factor for average out sources
+    static thread_local SessionParameter<double> weightAverageStations;   ///< weight factor for average out stations
+    static thread_local SessionParameter<double> weightAverageBaselines;  ///< weight factor for average out baselines
 
-    static thread_local double weightIdleTime;          ///< weight factor for extra weight after long idle time
-    static thread_local unsigned int idleTimeInterval;  ///< long idle time interval
+    /// weight factor for extra weight after long idle time
+    static thread_local SessionParameter<double> weightIdleTime;
+    static thread_local SessionParameter<unsigned int> idleTimeInterval;  ///< long idle time interval
 
-    static thread_local double weightClosures;          ///< weight factor for closure delays
-    static thread_local unsigned int maxClosures;       ///< maximum number of closure delays
+    static thread_local SessionParameter<double> weightClosures;          ///< weight factor for closure delays
+    static thread_local SessionParameter<unsigned int> maxClosures;       ///< maximum number of closure delays
 
-    static thread_local double weightDeclination;       ///< weight factor for declination
-    static thread_local double declinationStartWeight;  ///< start declination of additional weight
+    static thread_local SessionParameter<double> weightDeclination;       ///< weight factor for declination
+    static thread_local SessionParameter<double> declinationStartWeight;  ///< start declination of additional weight
     ///< (everything above has factor 0)
-    static thread_local double declinationFullWeight;  ///< end declination of additional declination weight slope
+    /// end declination of additional declination weight slope
+    static thread_local SessionParameter<double> declinationFullWeight;
     ///< (everything below has factor 1)
 
-    static thread_local double weightLowElevation;       ///< weight factor for low elevation scans
-    static thread_local double lowElevationStartWeight;  ///< start elevation of additional weight
+    static thread_local SessionParameter<double> weightLowElevation;       ///< weight factor for low elevation scans
+    static thread_local SessionParameter<double> lowElevationStartWeight;  ///< start elevation of additional weight
     ///< (everything above has factor 0)
-    static thread_local double lowElevationFullWeight;  ///< end elevation of additional declination weight slope
+    /// end elevation of additional declination weight slope
+    static thread_local SessionParameter<double> lowElevationFullWeight;
     ///< (everything below has factor 1)
 
 
@@ -0,0 +1,102 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Worker.h"
+
+#include <boost/property_tree/json_parser.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+
+using namespace std;
+using namespace VieVS;
+
+
+Worker::Worker( const std::string &address ) {
+    size_t found = address.find_last_of( ':' );
+    if ( found == string::npos ) {
+        throw runtime_error( "invalid coordinator address " + address + " (expected host:port)" );
+    }
+    string host = address.substr( 0, found );
+    string port = address.substr( found + 1 );
+
+    const char *token = getenv( "VIESCHEDPP_WORKER_TOKEN" );
+    if ( token == nullptr || *token == '\0' ) {
+        throw runtime_error( "environment variable VIESCHEDPP_WORKER_TOKEN (token of coordinator) is not set" );
+    }
+
+    for ( int i = 0; i < 60; ++i ) {
+        stream_.clear();
+        stream_.connect( host, port );
+        if ( stream_ ) {
+            break;
+        }
+        this_thread::sleep_for( chrono::seconds( 1 ) );
+    }
+    if ( !stream_ ) {
+        throw runtime_error( "unable to connect to coordinator " + address );
+    }
+
+#ifdef _WIN32
+    int pid = _getpid();
+#else
+    int pid = getpid();
+#endif
+    stream_ << "hello " << token << " " << boost::asio::ip::host_name() << " " << pid << endl;
+
+    string line;
+    if ( !getline( stream_, line ) || line.compare( 0, 6, "input " ) != 0 ) {
+        throw runtime_error( "invalid answer from coordinator " + address );
+    }
+    inputFile_ = line.substr( 6 );
+}
+
+
+bool Worker::nextJob( int &index, MultiScheduling::Parameters &parameters ) {
+    string line;
+    if ( !getline( stream_, line ) ) {
+        return false;
+    }
+    istringstream iss( line );
+    string keyword;
+    if ( !( iss >> keyword >> index ) || keyword != "job" ) {
+        return false;
+    }
+
+    boost::property_tree::ptree tree;
+    boost::property_tree::read_json( iss, tree );
+    parameters = MultiScheduling::Parameters( tree );
+    return true;
+}
+
+
+void Worker::finished( int index, const std::vector<std::string> &rows ) {
+    stream_ << "done " << index << " " << rows.size() << "\n";
+    for ( const auto &any : rows ) {
+        stream_ << any << "\n";
+    }
+    stream_.flush();
+}
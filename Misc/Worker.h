@@ -0,0 +1,101 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file Worker.h
+ * @brief class Worker
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+
+#ifndef WORKER_H
+#define WORKER_H
+
+
+#include <boost/asio.hpp>
+#include <string>
+#include <vector>
+
+#include "MultiScheduling.h"
+
+#ifdef VIESCHEDPP_LOG
+#include <boost/log/trivial.hpp>
+#endif
+
+
+namespace VieVS {
+/**
+ * @class Worker
+ * @brief connection of a worker process to the coordinator
+ *
+ * see Coordinator class for the protocol
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+class Worker {
+   public:
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * connects to coordinator, retries for one minute in case the coordinator is not yet running. The token of the
+     * coordinator is read from the environment variable VIESCHEDPP_WORKER_TOKEN.
+     *
+     * @param address coordinator address ("host:port")
+     */
+    explicit Worker( const std::string &address );
+
+
+    /**
+     * @brief get input file
+     * @author Matthias Schartner
+     *
+     * @return path to VieSchedpp.xml file
+     */
+    const std::string &getInputFile() const noexcept { return inputFile_; }
+
+
+    /**
+     * @brief get next job
+     * @author Matthias Schartner
+     *
+     * @param index index of multi scheduling parameters
+     * @param parameters multi scheduling parameters
+     * @return false if there are no further jobs
+     */
+    bool nextJob( int &index, MultiScheduling::Parameters &parameters );
+
+
+    /**
+     * @brief report finished job
+     * @author Matthias Schartner
+     *
+     * @param index index of multi scheduling parameters
+     * @param rows statistics rows
+     */
+    void finished( int index, const std::vector<std::string> &rows );
+
+   private:
+    boost::asio::ip::tcp::iostream stream_;  ///< connection to coordinator
+    std::string inputFile_;                  ///< path to VieSchedpp.xml file
+};
+}  // namespace VieVS
+
+#endif  // WORKER_H
@@ -359,6 +359,21 @@ std::string util::version2prefix(int version) {
     }
 }
 
+std::uint64_t util::streamSeed( std::uint64_t seed, std::initializer_list<std::uint64_t> keys ) {
+    // SplitMix64 finalizer: neighboring keys result in uncorrelated seeds
+    auto mix = []( std::uint64_t x ) {
+        x += 0x9e3779b97f4a7c15ULL;
+        x = ( x ^ ( x >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+        x = ( x ^ ( x >> 27 ) ) * 0x94d049bb133111ebULL;
+        return x ^ ( x >> 31 );
+    };
+    std::uint64_t h = mix( seed );
+    for ( std::uint64_t key : keys ) {
+        h = mix( h ^ key );
+    }
+    return h;
+}
+
 #ifdef COMPRESSION_ENABLED
 void util::compress( const string& path, const string &fname ) {
     // Construct version pattern for filtering and archive naming
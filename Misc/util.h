@@ -37,6 +37,8 @@
 #include <boost/format.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <cmath>
+#include <cstdint>
+#include <initializer_list>
 #include <numeric>
 #include <vector>
 #include <filesystem>
@@ -225,8 +227,8 @@ T absDiff( const T &a, const T &b ) {
  * @param v vector
  * @return indices of sorted vector elements
  */
-template <typename T>
-std::vector<int> sortIndexes( const std::vector<T> &v ) {
+template <typename Container>
+std::vector<int> sortIndexes( const Container &v ) {
     // initialize original index locations
     std::vector<int> idx( v.size() );
     std::iota( idx.begin(), idx.end(), 0 );
@@ -387,6 +389,21 @@ std::string milliseconds2string( long long int usec, bool forceSeconds = false )
 std::string version2prefix(int version);
 
 
+/**
+ * @brief seed of an independent random number stream
+ * @author Matthias Schartner
+ *
+ * The stream is identified by the base seed and its keys (e.g. generation, version, station, simulation run) only.
+ * It does not depend on how many other streams were used before, so results are reproducible regardless of the
+ * number of threads and the order in which the work is processed.
+ *
+ * @param seed base seed
+ * @param keys stream keys
+ * @return seed of random number generator engine
+ */
+std::uint64_t streamSeed( std::uint64_t seed, std::initializer_list<std::uint64_t> keys );
+
+
 /**
  * @brief compress output files
  * @author Matthias Schartner
@@ -10,25 +10,30 @@ using namespace std;
 
 unsigned long VieVS::ObservingMode::nextId = 0;
 
-VieVS::ObservingMode::Type VieVS::ObservingMode::type = VieVS::ObservingMode::Type::simple;
+thread_local SessionParameter<VieVS::ObservingMode::Type> VieVS::ObservingMode::type =
+    VieVS::ObservingMode::Type::simple;
 
-std::set<std::string> VieVS::ObservingMode::bands;
-std::unordered_map<std::string, double> VieVS::ObservingMode::wavelengths{
-    { "S", util::freqency2wavelenth( 2291 * 1e6 ) }, { "X", util::freqency2wavelenth( 8593 * 1e6 ) } };
+thread_local SessionParameter<std::set<std::string>> VieVS::ObservingMode::bands;
+thread_local SessionParameter<std::unordered_map<std::string, double>> VieVS::ObservingMode::wavelengths =
+    std::unordered_map<std::string, double>{ { "S", util::freqency2wavelenth( 2291 * 1e6 ) },
+                                             { "X", util::freqency2wavelenth( 8593 * 1e6 ) } };
 
-std::unordered_map<std::string, double> VieVS::ObservingMode::minSNR;  ///< backup min SNR
+/// backup min SNR
+thread_local SessionParameter<std::unordered_map<std::string, double>> VieVS::ObservingMode::minSNR;
 
-std::unordered_map<std::string, VieVS::ObservingMode::Property>
+thread_local SessionParameter<std::unordered_map<std::string, VieVS::ObservingMode::Property>>
     VieVS::ObservingMode::stationProperty;  ///< is band required or optional for station
-std::unordered_map<std::string, VieVS::ObservingMode::Backup>
+thread_local SessionParameter<std::unordered_map<std::string, VieVS::ObservingMode::Backup>>
     VieVS::ObservingMode::stationBackup;                                           ///< backup version for station
-std::unordered_map<std::string, double> VieVS::ObservingMode::stationBackupValue;  ///< backup value for station
+/// backup value for station
+thread_local SessionParameter<std::unordered_map<std::string, double>> VieVS::ObservingMode::stationBackupValue;
 
-std::unordered_map<std::string, VieVS::ObservingMode::Property>
+thread_local SessionParameter<std::unordered_map<std::string, VieVS::ObservingMode::Property>>
     VieVS::ObservingMode::sourceProperty;  ///< is band required or optional for source
-std::unordered_map<std::string, VieVS::ObservingMode::Backup>
+thread_local SessionParameter<std::unordered_map<std::string, VieVS::ObservingMode::Backup>>
     VieVS::ObservingMode::sourceBackup;                                           ///< backup version for source
-std::unordered_map<std::string, double> VieVS::ObservingMode::sourceBackupValue;  ///< backup value for source
+/// backup value for source
+thread_local SessionParameter<std::unordered_map<std::string, double>> VieVS::ObservingMode::sourceBackupValue;
 
 ObservingMode::ObservingMode() : VieVS_Object( nextId++ ) {}
 
@@ -179,7 +184,7 @@ void ObservingMode::simpleMode( unsigned long nsta, double samplerate, unsigned
     auto mode = make_shared<Mode>( "type", nsta );
 
     for ( const auto &any : band2channel ) {
-        bands.insert( any.first );
+        bands.edit().insert( any.first );
         double recRate = samplerate * bits * any.second * 1e6;
         mode->setRecordingRates( any.first, recRate );
 
@@ -198,7 +203,7 @@ void ObservingMode::simpleMode( unsigned long nsta, double samplerate, unsigned
     mode->setBands( bands );
     addMode( mode );
     for ( const auto &any : band2wavelength ) {
-        wavelengths[any.first] = any.second;
+        wavelengths.edit()[any.first] = any.second;
     }
 }
 
@@ -715,15 +720,15 @@ void ObservingMode::calcMeanFrequencies() {
 
         double meanFrequency = std::accumulate( frequencies.begin(), frequencies.end(), 0.0 ) / frequencies.size();
         double meanWavelength = util::freqency2wavelenth( meanFrequency * 1e6 );
-        wavelengths[band] = meanWavelength;
+        wavelengths.edit()[band] = meanWavelength;
     }
 }
 
 
 void ObservingMode::addDummyBands( const std::map<std::string, std::vector<double>> &band ) {
     for ( const auto &any : band ) {
-        bands.insert( any.first );
+        bands.edit().insert( any.first );
         double mfreq = accumulate( any.second.begin(), any.second.end(), 0.0 ) / any.second.size();
-        wavelengths[any.first] = mfreq;
+        wavelengths.edit()[any.first] = mfreq;
     }
 }
@@ -20,6 +20,7 @@
 #define VIESCHEDPP_OBSMODES_H
 
 
+#include "../Misc/SessionParameter.h"
 #include "Mode.h"
 
 /**
@@ -73,20 +74,29 @@ class ObservingMode : public VieVS_Object {
         custom,  ///< custom observing mode
     };
 
-    static Type type;  ///< flag if manual observation mode was selected
+    static thread_local SessionParameter<Type> type;  ///< flag if manual observation mode was selected
 
-    static std::unordered_map<std::string, double> minSNR;  ///< minimum signal to noise ration per band
+    /// minimum signal to noise ration per band
+    static thread_local SessionParameter<std::unordered_map<std::string, double>> minSNR;
 
-    static std::unordered_map<std::string, Property> stationProperty;   ///< is band required or optional for station
-    static std::unordered_map<std::string, Backup> stationBackup;       ///< backup version for station
-    static std::unordered_map<std::string, double> stationBackupValue;  ///< backup value for station
+    /// is band required or optional for station
+    static thread_local SessionParameter<std::unordered_map<std::string, Property>> stationProperty;
+    /// backup version for station
+    static thread_local SessionParameter<std::unordered_map<std::string, Backup>> stationBackup;
+    /// backup value for station
+    static thread_local SessionParameter<std::unordered_map<std::string, double>> stationBackupValue;
 
-    static std::unordered_map<std::string, Property> sourceProperty;   ///< is band required or optional for source
-    static std::unordered_map<std::string, Backup> sourceBackup;       ///< backup version for source
-    static std::unordered_map<std::string, double> sourceBackupValue;  ///< backup value for source
+    /// is band required or optional for source
+    static thread_local SessionParameter<std::unordered_map<std::string, Property>> sourceProperty;
+    /// backup version for source
+    static thread_local SessionParameter<std::unordered_map<std::string, Backup>> sourceBackup;
+    /// backup value for source
+    static thread_local SessionParameter<std::unordered_map<std::string, double>> sourceBackupValue;
 
-    static std::set<std::string> bands;                          ///< list of all observed bands
-    static std::unordered_map<std::string, double> wavelengths;  ///< backup wavelength for commonly used bands
+    /// list of all observed bands
+    static thread_local SessionParameter<std::set<std::string>> bands;
+    /// backup wavelength for commonly used bands
+    static thread_local SessionParameter<std::unordered_map<std::string, double>> wavelengths;
 
     /**
      * @brief constructor
@@ -185,7 +195,7 @@ class ObservingMode : public VieVS_Object {
     void addBlock( const std::shared_ptr<const Freq> &newFreq ) {
         freqs_.push_back( newFreq );
         const auto &tmp = newFreq->getBands();
-        ObservingMode::bands.insert( tmp.begin(), tmp.end() );
+        ObservingMode::bands.edit().insert( tmp.begin(), tmp.end() );
     }
 
 
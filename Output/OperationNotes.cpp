@@ -88,12 +88,14 @@ void OperationNotes::writeOperationNotes( const Network &network, const SourceLi
     of << "\n";
 
 
-    of << boost::format( "Date of experiment: %4d,%3s,%02d\n" ) % ( TimeSystem::startTime.date().year() ) %
-              ( TimeSystem::startTime.date().month() ) % ( TimeSystem::startTime.date().day() );
-    of << boost::format( "Nominal Start Time: %02dh%02d UT\n" ) % ( TimeSystem::startTime.time_of_day().hours() ) %
-              ( TimeSystem::startTime.time_of_day().minutes() );
-    of << boost::format( "Nominal End Time:   %02dh%02d UT\n" ) % ( TimeSystem::endTime.time_of_day().hours() ) %
-              ( TimeSystem::endTime.time_of_day().minutes() );
+    const boost::posix_time::ptime &startTime = TimeSystem::startTime;
+    const boost::posix_time::ptime &endTime = TimeSystem::endTime;
+    of << boost::format( "Date of experiment: %4d,%3s,%02d\n" ) % ( startTime.date().year() ) %
+              ( startTime.date().month() ) % ( startTime.date().day() );
+    of << boost::format( "Nominal Start Time: %02dh%02d UT\n" ) % ( startTime.time_of_day().hours() ) %
+              ( startTime.time_of_day().minutes() );
+    of << boost::format( "Nominal End Time:   %02dh%02d UT\n" ) % ( endTime.time_of_day().hours() ) %
+              ( endTime.time_of_day().minutes() );
     of << boost::format( "Duration:           %.1f hr\n" ) % ( TimeSystem::duration / 3600. );
     of << "Correlator:         " << xml.get( "VieSchedpp.output.correlator", "unknown" ) << "\n\n";
 
@@ -36,7 +36,7 @@ Output::Output(Scheduler &sched)
           version_{sched.version_} {}
 
 
-void Output::createAllOutputFiles( std::ofstream &of, const SkdCatalogReader &skdCatalogReader ) {
+void Output::createAllOutputFiles( StatisticsTable &statistics, const SkdCatalogReader &skdCatalogReader ) {
     string prefix = util::version2prefix(version_);
 #ifdef VIESCHEDPP_LOG
     BOOST_LOG_TRIVIAL(info) << prefix << "generate output files";
@@ -54,7 +54,7 @@ void Output::createAllOutputFiles( std::ofstream &of, const SkdCatalogReader &sk
     sortSchedule();
 
     if ( !xml_.get_child_optional( "VieSchedpp.simulator" ).is_initialized() ) {
-        writeStatistics( of );
+        writeStatistics( statistics );
     }
 
     if ( xml_.get<bool>( "VieSchedpp.output.createSummary", false ) ) {
@@ -346,7 +346,7 @@ void Output::writeNGS() {
 }
 
 
-void Output::writeStatistics( std::ofstream &of ) {
+void Output::writeStatistics( StatisticsTable &statistics ) {
     string oString;
 
     auto n_scans = static_cast<int>( scans_.size() );
@@ -596,10 +596,7 @@ void Output::writeStatistics( std::ofstream &of ) {
     }
 
 
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-    { of << oString << endl; };
+    statistics.addRow( version_, oString );
 }
 
 void Output::writeTimeTable() {
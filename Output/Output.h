@@ -33,6 +33,7 @@
 #include "SNR_table.h"
 #include "Skd.h"
 #include "SourceStatistics.h"
+#include "StatisticsTable.h"
 #include "Vex.h"
 #include "boost/format.hpp"
 #ifdef VIESCHEDPP_LOG
@@ -70,12 +71,12 @@ class Output : public VieVS_NamedObject {
 
 
     /**
-     * @brief write statistics line to statistics.csv file
+     * @brief add statistics of this schedule to statistics table
      * @author Matthias Schartner
      *
-     * @param of statistics.csv file
+     * @param statistics statistics table
      */
-    void writeStatistics( std::ofstream &of );
+    void writeStatistics( StatisticsTable &statistics );
 
 
     /**
@@ -145,10 +146,10 @@ class Output : public VieVS_NamedObject {
      * @brief create all output files
      * @author Matthias Schartner
      *
-     * @param of statistics.csv file
+     * @param statistics statistics table
      * @param skdCatalogReader sked catalogs
      */
-    void createAllOutputFiles( std::ofstream &of, const SkdCatalogReader &skdCatalogReader );
+    void createAllOutputFiles( StatisticsTable &statistics, const SkdCatalogReader &skdCatalogReader );
 
     /**
      * @brief generate sky-coverage files for debugging
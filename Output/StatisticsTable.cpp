@@ -0,0 +1,154 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StatisticsTable.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+
+using namespace std;
+using namespace VieVS;
+
+
+StatisticsTable::~StatisticsTable() {
+    Row *row = pending_.exchange( nullptr );
+    while ( row != nullptr ) {
+        Row *next = row->next;
+        delete row;
+        row = next;
+    }
+}
+
+
+void StatisticsTable::setHeader( const std::string &csvHeader ) {
+    csvHeader_ = csvHeader;
+    csvHeader_.erase( csvHeader_.find_last_not_of( "\r\n" ) + 1 );
+    header_ = split( csvHeader_ );
+    if ( columns_.size() < header_.size() ) {
+        columns_.resize( header_.size(), vector<double>( versions_.size(), numeric_limits<double>::quiet_NaN() ) );
+    }
+}
+
+
+void StatisticsTable::addRow( int version, const std::string &csvRow ) {
+    auto row = new Row{ version, csvRow, {}, nullptr };
+    row->csv.erase( row->csv.find_last_not_of( "\r\n" ) + 1 );
+
+    // parse values outside of any synchronization
+    for ( const auto &field : split( row->csv ) ) {
+        char *end = nullptr;
+        double val = strtod( field.c_str(), &end );
+        if ( end != field.c_str() + field.size() ) {
+            val = numeric_limits<double>::quiet_NaN();
+        }
+        row->values.push_back( val );
+    }
+
+    if ( ostream *journal = journal_.load() ) {
+        lock_guard<mutex> lock( journalMutex_ );
+        *journal << version << " " << row->csv << endl;
+    }
+
+    row->next = pending_.load( memory_order_relaxed );
+    while ( !pending_.compare_exchange_weak( row->next, row, memory_order_release, memory_order_relaxed ) ) {
+    }
+}
+
+
+void StatisticsTable::setJournal( std::ostream *journal ) {
+    lock_guard<mutex> lock( journalMutex_ );
+    journal_.store( journal );
+}
+
+
+void StatisticsTable::merge() {
+    Row *row = pending_.exchange( nullptr, memory_order_acquire );
+
+    // pending rows are stored most recent first
+    vector<Row *> rows;
+    while ( row != nullptr ) {
+        rows.push_back( row );
+        row = row->next;
+    }
+    reverse( rows.begin(), rows.end() );
+
+    for ( Row *any : rows ) {
+        if ( columns_.size() < any->values.size() ) {
+            columns_.resize( any->values.size(),
+                             vector<double>( versions_.size(), numeric_limits<double>::quiet_NaN() ) );
+        }
+        for ( unsigned long i = 0; i < columns_.size(); ++i ) {
+            columns_[i].push_back( i < any->values.size() ? any->values[i] : numeric_limits<double>::quiet_NaN() );
+        }
+        versions_.push_back( any->version );
+        csvRows_.push_back( move( any->csv ) );
+        delete any;
+    }
+}
+
+
+void StatisticsTable::writeCsv( std::ostream &of ) {
+    if ( !headerWritten_ ) {
+        of << csvHeader_ << endl;
+        headerWritten_ = true;
+    }
+    for ( ; nWritten_ < csvRows_.size(); ++nWritten_ ) {
+        of << csvRows_[nWritten_] << "\n";
+    }
+    of.flush();
+}
+
+
+std::map<int, std::vector<double>> StatisticsTable::select( const std::vector<int> &columns ) const {
+    map<int, vector<double>> storage;
+    for ( unsigned long r = 0; r < versions_.size(); ++r ) {
+        vector<double> vals;
+        vals.reserve( columns.size() );
+        for ( int c : columns ) {
+            double val = numeric_limits<double>::quiet_NaN();
+            if ( c >= 0 && static_cast<unsigned long>( c ) < columns_.size() ) {
+                val = columns_[c][r];
+            }
+            if ( val == 9999 ) {
+                val = numeric_limits<double>::quiet_NaN();
+            }
+            vals.push_back( val );
+        }
+        storage[versions_[r]] = move( vals );
+    }
+    return storage;
+}
+
+
+std::vector<std::string> StatisticsTable::split( const std::string &line ) {
+    vector<string> fields;
+    unsigned long start = 0;
+    while ( start <= line.size() ) {
+        unsigned long end = line.find( ',', start );
+        if ( end == string::npos ) {
+            end = line.size();
+        }
+        if ( end > start || fields.empty() ) {
+            fields.push_back( line.substr( start, end - start ) );
+        }
+        start = end + 1;
+    }
+    return fields;
+}
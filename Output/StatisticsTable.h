@@ -0,0 +1,211 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file StatisticsTable.h
+ * @brief class StatisticsTable
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+
+#ifndef STATISTICSTABLE_H
+#define STATISTICSTABLE_H
+
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+namespace VieVS {
+/**
+ * @class StatisticsTable
+ * @brief in memory table of the statistics of all schedule versions
+ *
+ * Every schedule (or simulation) adds one row. Rows are added lock-free from any thread and parsed only once.
+ * After each generation merge() moves the new rows into the columnar storage, which is used to rank the versions.
+ * The statistics.csv file is only one serialization of this table (see writeCsv()).
+ *
+ * Fields are separated by one or more commas, missing or non-numeric values are stored as NaN.
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+class StatisticsTable {
+   public:
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     */
+    StatisticsTable() = default;
+
+    StatisticsTable( const StatisticsTable & ) = delete;
+
+    StatisticsTable &operator=( const StatisticsTable & ) = delete;
+
+    /**
+     * @brief destructor
+     * @author Matthias Schartner
+     */
+    ~StatisticsTable();
+
+
+    /**
+     * @brief set column names
+     * @author Matthias Schartner
+     *
+     * @param csvHeader comma separated header line
+     */
+    void setHeader( const std::string &csvHeader );
+
+
+    /**
+     * @brief get column names
+     * @author Matthias Schartner
+     *
+     * @return column names
+     */
+    const std::vector<std::string> &getHeader() const noexcept { return header_; }
+
+
+    /**
+     * @brief add row of one version
+     * @author Matthias Schartner
+     *
+     * thread safe and lock-free, the row becomes visible after the next call to merge()
+     *
+     * @param version version number
+     * @param csvRow comma separated row (starting with the version number)
+     */
+    void addRow( int version, const std::string &csvRow );
+
+
+    /**
+     * @brief write all rows added from now on also to a journal
+     * @author Matthias Schartner
+     *
+     * Each row is written (and flushed) as "<version> <csv row>" as soon as it is added. The journal is used to
+     * resume an interrupted run, writing it is the only part of addRow() which is synchronized.
+     *
+     * @param journal output stream (nullptr to disable journal)
+     */
+    void setJournal( std::ostream *journal );
+
+
+    /**
+     * @brief move all added rows into the table
+     * @author Matthias Schartner
+     *
+     * must not be called concurrently with other member functions except addRow()
+     */
+    void merge();
+
+
+    /**
+     * @brief number of rows in table
+     * @author Matthias Schartner
+     *
+     * @return number of rows
+     */
+    unsigned long getNRows() const noexcept { return versions_.size(); }
+
+
+    /**
+     * @brief get version number of row
+     * @author Matthias Schartner
+     *
+     * @param row row index
+     * @return version number
+     */
+    int getVersion( unsigned long row ) const { return versions_.at( row ); }
+
+
+    /**
+     * @brief get row in csv format
+     * @author Matthias Schartner
+     *
+     * @param row row index
+     * @return comma separated row
+     */
+    const std::string &getCsvRow( unsigned long row ) const { return csvRows_.at( row ); }
+
+
+    /**
+     * @brief write all rows which were not written yet in csv format
+     * @author Matthias Schartner
+     *
+     * header is written with first call
+     *
+     * @param of output stream
+     */
+    void writeCsv( std::ostream &of );
+
+
+    /**
+     * @brief select columns of all versions
+     * @author Matthias Schartner
+     *
+     * invalid column indices and values of 9999 (no result) are returned as NaN.
+     * If a version was added multiple times the last row is used.
+     *
+     * @param columns column indices
+     * @return values per version
+     */
+    std::map<int, std::vector<double>> select( const std::vector<int> &columns ) const;
+
+   private:
+    /**
+     * @brief row which is not yet merged into the table
+     * @author Matthias Schartner
+     */
+    struct Row {
+        int version;                 ///< version number
+        std::string csv;             ///< comma separated row
+        std::vector<double> values;  ///< parsed values
+        Row *next;                   ///< previously added row
+    };
+
+    std::atomic<Row *> pending_{ nullptr };  ///< rows added since last merge (most recent first)
+
+    std::vector<std::string> header_;           ///< column names
+    std::string csvHeader_;                     ///< header line
+    std::vector<int> versions_;                 ///< version number per row
+    std::vector<std::vector<double>> columns_;  ///< values per column and row
+    std::vector<std::string> csvRows_;          ///< comma separated rows
+    unsigned long nWritten_ = 0;                ///< number of rows already written to csv
+    bool headerWritten_ = false;                ///< flag if header was already written to csv
+
+    std::atomic<std::ostream *> journal_{ nullptr };  ///< journal of added rows
+    std::mutex journalMutex_;                         ///< synchronizes writing to journal
+
+    /**
+     * @brief split comma separated line
+     * @author Matthias Schartner
+     *
+     * @param line comma separated line
+     * @return fields
+     */
+    static std::vector<std::string> split( const std::string &line );
+};
+}  // namespace VieVS
+
+#endif  // STATISTICSTABLE_H
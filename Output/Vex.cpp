@@ -436,18 +436,18 @@ void Vex::sched_block( const std::vector<Scan> &scans, const Network &network, c
         of << "        mode = " << obsModes->getMode( 0 )->getName() << eol;
         of << "        source = " << sourceList.getSource( srcid )->getName() << eol;
         if ( scan.getType() == Scan::ScanType::fringeFinder ) {
-            if ( !CalibratorBlock::intent_.empty() && CalibratorBlock::intent_ != "NONE" ) {
+            if ( !CalibratorBlock::intent_.empty() && CalibratorBlock::intent_.get() != "NONE" ) {
                 of << boost::format( "*       intent = %s : True;\n" ) % CalibratorBlock::intent_;
             }
         }
         if ( scan.getType() == Scan::ScanType::parallacticAngle ) {
-            if ( !ParallacticAngleBlock::intent_.empty() && ParallacticAngleBlock::intent_ != "NONE" ) {
+            if ( !ParallacticAngleBlock::intent_.empty() && ParallacticAngleBlock::intent_.get() != "NONE" ) {
                 of << boost::format( "*       intent = %s : True;\n" ) % ParallacticAngleBlock::intent_;
             }
         }
         if ( scan.getType() == Scan::ScanType::diffParallacticAngle ) {
             if ( !DifferentialParallacticAngleBlock::intent_.empty() &&
-                 DifferentialParallacticAngleBlock::intent_ != "NONE" ) {
+                 DifferentialParallacticAngleBlock::intent_.get() != "NONE" ) {
                 of << boost::format( "*       intent = %s : True;\n" ) % DifferentialParallacticAngleBlock::intent_;
             }
         }
@@ -676,18 +676,18 @@ void VieVS::Vex::schedBlockTracking( const std::vector<Scan> &scans, const VieVS
                 of << "        mode = " << obsModes->getMode( 0 )->getName() << eol;
                 of << "        source = " << name << eol;
                 if ( scan.getType() == Scan::ScanType::fringeFinder ) {
-                    if ( !CalibratorBlock::intent_.empty() && CalibratorBlock::intent_ != "NONE" ) {
+                    if ( !CalibratorBlock::intent_.empty() && CalibratorBlock::intent_.get() != "NONE" ) {
                         of << boost::format( "*       intent = %s : True;\n" ) % CalibratorBlock::intent_;
                     }
                 }
                 if ( scan.getType() == Scan::ScanType::parallacticAngle ) {
-                    if ( !ParallacticAngleBlock::intent_.empty() && ParallacticAngleBlock::intent_ != "NONE" ) {
+                    if ( !ParallacticAngleBlock::intent_.empty() && ParallacticAngleBlock::intent_.get() != "NONE" ) {
                         of << boost::format( "*       intent = %s : True;\n" ) % ParallacticAngleBlock::intent_;
                     }
                 }
                 if ( scan.getType() == Scan::ScanType::diffParallacticAngle ) {
                     if ( !DifferentialParallacticAngleBlock::intent_.empty() &&
-                         DifferentialParallacticAngleBlock::intent_ != "NONE" ) {
+                         DifferentialParallacticAngleBlock::intent_.get() != "NONE" ) {
                         of << boost::format( "*       intent = %s : True;\n" ) %
                                   DifferentialParallacticAngleBlock::intent_;
                     }
@@ -765,18 +765,18 @@ void VieVS::Vex::schedBlockTracking( const std::vector<Scan> &scans, const VieVS
             of << "        mode = " << obsModes->getMode( 0 )->getName() << eol;
             of << "        source = " << sourceList.getSource( srcid )->getName() << eol;
             if ( scan.getType() == Scan::ScanType::fringeFinder ) {
-                if ( !CalibratorBlock::intent_.empty() && CalibratorBlock::intent_ != "NONE" ) {
+                if ( !CalibratorBlock::intent_.empty() && CalibratorBlock::intent_.get() != "NONE" ) {
                     of << boost::format( "*       intent = %s : True;\n" ) % CalibratorBlock::intent_;
                 }
             }
             if ( scan.getType() == Scan::ScanType::parallacticAngle ) {
-                if ( !ParallacticAngleBlock::intent_.empty() && ParallacticAngleBlock::intent_ != "NONE" ) {
+                if ( !ParallacticAngleBlock::intent_.empty() && ParallacticAngleBlock::intent_.get() != "NONE" ) {
                     of << boost::format( "*       intent = %s : True;\n" ) % ParallacticAngleBlock::intent_;
                 }
             }
             if ( scan.getType() == Scan::ScanType::diffParallacticAngle ) {
                 if ( !DifferentialParallacticAngleBlock::intent_.empty() &&
-                     DifferentialParallacticAngleBlock::intent_ != "NONE" ) {
+                     DifferentialParallacticAngleBlock::intent_.get() != "NONE" ) {
                     of << boost::format( "*       intent = %s : True;\n" ) % DifferentialParallacticAngleBlock::intent_;
                 }
             }
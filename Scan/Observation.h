@@ -28,6 +28,9 @@
 #define OBSERVATION_H
 
 
+#include <memory_resource>
+#include <vector>
+
 #include "../Misc/VieVS_Object.h"
 
 
@@ -178,6 +181,15 @@ class Observation : public VieVS_Object {
     unsigned int startTime_;      ///< observation start time
     unsigned int observingTime_;  ///< observation duration
 };
+
+
+/**
+ * @brief observations of one scan
+ * @author Matthias Schartner
+ *
+ * Candidate scans allocate them from the scan selection arena (see Arena), copies use the default memory resource.
+ */
+using Observations = std::pmr::vector<Observation>;
 }  // namespace VieVS
 
 #endif  // OBSERVATION_H
@@ -28,6 +28,7 @@
 #define VLBI_POINTINGVECTOR_H
 
 
+#include <boost/container/small_vector.hpp>
 #include <boost/date_time.hpp>
 #include <iostream>
 #include <limits>
@@ -248,5 +249,12 @@ class PointingVector : public VieVS_Object {
     double dc_{ 0 };       ///< local hour angle in radians
     unsigned int time_;    ///< time in seconds since session start for which azimuth and elevation is calculated
 };
+
+
+/**
+ * @brief pointing vectors of all stations of one scan, stored inline for typical network sizes
+ * @author Matthias Schartner
+ */
+using PointingVectors = boost::container::small_vector<PointingVector, 16>;
 }  // namespace VieVS
 #endif /* VLBI_POINTINGVECTOR_H */
@@ -29,11 +29,12 @@
 using namespace std;
 using namespace VieVS;
 
-unsigned int Scan::nScanSelections{ 0 };
+thread_local SessionParameter<unsigned int> Scan::nScanSelections{ 0 };
 
-bool Scan::scanSequence_flag = false;                     ///< true if you have a custom scan sequence
-thread_local unsigned int Scan::scanSequence_modulo = 0;  ///< modulo of scan selection scanSequence_cadence
-std::map<unsigned int, std::vector<unsigned long>>
+thread_local SessionParameter<bool> Scan::scanSequence_flag = false;        ///< true if you have a custom scan sequence
+/// modulo of scan selection scanSequence_cadence
+thread_local SessionParameter<unsigned int> Scan::scanSequence_modulo = 0;
+thread_local SessionParameter<std::map<unsigned int, std::vector<unsigned long>>>
     Scan::scanSequence_target;  ///< map with modulo number as key and list of target source ids as value
 
 unsigned long Scan::nextId = 0;
@@ -42,7 +43,8 @@ unsigned long Scan::nextId = 0;
 Scan::Scan( vector<PointingVector> &pointingVectors, vector<unsigned int> &endOfLastScan, ScanType type )
     : VieVS_Object( nextId++ ),
       times_{ ScanTimes( static_cast<unsigned int>( pointingVectors.size() ) ) },
-      pointingVectorsStart_{ move( pointingVectors ) },
+      pointingVectorsStart_( make_move_iterator( pointingVectors.begin() ),
+                             make_move_iterator( pointingVectors.end() ) ),
       type_{ type },
       constellation_{ ScanConstellation::single },
       score_{ 0 } {
@@ -53,11 +55,11 @@ Scan::Scan( vector<PointingVector> &pointingVectors, vector<unsigned int> &endOf
 }
 
 
-Scan::Scan( vector<PointingVector> pv, ScanTimes times, vector<Observation> obs, ScanType type )
+Scan::Scan( const PointingVectors &pv, ScanTimes times, Observations obs, ScanType type )
     : VieVS_Object( nextId++ ),
       srcid_{ pv[0].getSrcid() },
       nsta_{ static_cast<unsigned long>(pv.size()) },
-      pointingVectorsStart_{ move( pv ) },
+      pointingVectorsStart_{ pv },
       score_{ 0 },
       times_{ move( times ) },
       observations_{ move( obs ) },
@@ -1285,7 +1287,12 @@ bool Scan::rigorousSatelliteAvoidance( Network &network, const std::shared_ptr<c
         for ( auto tt : times ) {
             pair<double, double> rade_src = source->getRaDe( tt, sta.getPosition() );
             for ( const auto &sat : AvoidSatellites::satellitesToAvoid ) {
-                const vector<pair<int, int>> &precalc = AvoidSatellites::visible_[staid][sat->getId()];
+                const auto &visibleSatellites = AvoidSatellites::visible_[staid];
+                auto itVisible = visibleSatellites.find( sat->getId() );
+                if ( itVisible == visibleSatellites.end() ) {
+                    continue;
+                }
+                const vector<pair<int, int>> &precalc = itVisible->second;
                 bool calc = false;
                 for ( const auto &any : precalc ) {
                     unsigned int start = any.first;
@@ -2039,10 +2046,10 @@ void Scan::output( unsigned long observed_scan_nr, const Network &network,
 
 boost::optional<Scan> Scan::copyScan( const std::vector<unsigned long> &ids,
                                       const std::shared_ptr<const AbstractSource> &source ) const noexcept {
-    vector<PointingVector> pv;
+    PointingVectors pv;
     pv.reserve( ids.size() );
     ScanTimes t = times_;
-    vector<Observation> obs;
+    Observations obs( Arena::resource() );
 
     int counter = 0;
     // add all found pointing vectors to new pointing vector vector
@@ -2095,7 +2102,7 @@ boost::optional<Scan> Scan::copyScan( const std::vector<unsigned long> &ids,
         return boost::none;
     }
 
-    return Scan( move( pv ), move( t ), move( obs ), type_ );
+    return Scan( pv, move( t ), move( obs ), type_ );
 }
 
 
@@ -2150,7 +2157,9 @@ bool Scan::setScanTimes( const vector<unsigned int> &eols, const vector<unsigned
 }
 
 
-void Scan::setPointingVectorsEndtime( vector<PointingVector> pv_end ) { pointingVectorsEnd_ = std::move( pv_end ); }
+void Scan::setPointingVectorsEndtime( vector<PointingVector> pv_end ) {
+    pointingVectorsEnd_.assign( make_move_iterator( pv_end.begin() ), make_move_iterator( pv_end.end() ) );
+}
 
 
 void Scan::createDummyObservations( const Network &network ) {
@@ -36,6 +36,7 @@
 #include <utility>
 #include <vector>
 
+#include "../Misc/Arena.h"
 #include "../Misc/AstrometricCalibratorBlock.h"
 #include "../Misc/AvoidSatellites.h"
 #include "../Misc/CalibratorBlock.h"
@@ -48,6 +49,7 @@
 #include "../ObservingMode/Mode.h"
 #include "../Source/AbstractSource.h"
 #include "../Station/Network.h"
+#include "../Misc/SessionParameter.h"
 #include "Observation.h"
 #include "PointingVector.h"
 #include "ScanTimes.h"
@@ -64,7 +66,7 @@ namespace VieVS {
  */
 class Scan : public VieVS_Object {
    public:
-    static unsigned int nScanSelections;  ///< number of selected main scans
+    static thread_local SessionParameter<unsigned int> nScanSelections;  ///< number of selected main scans
 
     /**
      * @brief scan constellation type
@@ -138,9 +140,11 @@ class Scan : public VieVS_Object {
      * @brief specify custom scan sequence rules
      * @author Matthias Schartner
      */
-    static bool scanSequence_flag;                         ///< true if you have a custom scan sequence
-    static thread_local unsigned int scanSequence_modulo;  ///< modulo of scan selection scanSequence_cadence
-    static std::map<unsigned int, std::vector<unsigned long>>
+    /// true if you have a custom scan sequence
+    static thread_local SessionParameter<bool> scanSequence_flag;
+    /// modulo of scan selection scanSequence_cadence
+    static thread_local SessionParameter<unsigned int> scanSequence_modulo;
+    static thread_local SessionParameter<std::map<unsigned int, std::vector<unsigned long>>>
         scanSequence_target;  ///< map with modulo number as key and list of target source ids as value
 
     /**
@@ -190,8 +194,7 @@ class Scan : public VieVS_Object {
      * @param obs all observations
      * @param type scan type (default = Scan::ScanType::standard)
      */
-    Scan( std::vector<PointingVector> pv, ScanTimes times, std::vector<Observation> obs,
-          ScanType type = Scan::ScanType::standard );
+    Scan( const PointingVectors &pv, ScanTimes times, Observations obs, ScanType type = Scan::ScanType::standard );
 
     /**
      * @brief constructor based on property tree
@@ -361,7 +364,7 @@ class Scan : public VieVS_Object {
      *
      * @return vector of all observations
      */
-    std::vector<Observation> &refObservations() { return observations_; };
+    Observations &refObservations() { return observations_; };
 
     /**
      * @brief get all observations
@@ -369,7 +372,7 @@ class Scan : public VieVS_Object {
      *
      * @return all observations
      */
-    const std::vector<Observation> &getObservations() const noexcept { return observations_; }
+    const Observations &getObservations() const noexcept { return observations_; }
 
 
     /**
@@ -792,7 +795,7 @@ class Scan : public VieVS_Object {
      *
      * @param obs observations
      */
-    void setObservations( std::vector<Observation> obs ) { this->observations_ = std::move( obs ); };
+    void setObservations( const std::vector<Observation> &obs ) { observations_.assign( obs.begin(), obs.end() ); };
 
 
     /**
@@ -952,10 +955,10 @@ class Scan : public VieVS_Object {
 
     double score_;  ///< total score
 
-    ScanTimes times_;                                   ///< time information
-    std::vector<PointingVector> pointingVectorsStart_;  ///< pointing vectors at start of the scan
-    std::vector<PointingVector> pointingVectorsEnd_;    ///< pointing vectors at end of the scan
-    std::vector<Observation> observations_;             ///< all observed baselines
+    ScanTimes times_;                                 ///< time information
+    PointingVectors pointingVectorsStart_;            ///< pointing vectors at start of the scan
+    PointingVectors pointingVectorsEnd_;              ///< pointing vectors at end of the scan
+    Observations observations_{ Arena::resource() };  ///< all observed baselines
 
     ScanType type_;                    ///< type of the scan
     ScanConstellation constellation_;  /// scan constellation type
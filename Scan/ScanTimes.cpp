@@ -22,7 +22,7 @@
 using namespace std;
 using namespace VieVS;
 unsigned long ScanTimes::nextId = 0;
-ScanTimes::AlignmentAnchor ScanTimes::anchor = ScanTimes::AlignmentAnchor::start;
+thread_local SessionParameter<ScanTimes::AlignmentAnchor> ScanTimes::anchor = ScanTimes::AlignmentAnchor::start;
 
 
 ScanTimes::ScanTimes( unsigned int nsta ) : VieVS_Object( nextId++ ) {
@@ -28,9 +28,11 @@
 #define SCANTIMES_H
 
 
+#include <boost/container/small_vector.hpp>
 #include <limits>
 #include <vector>
 
+#include "../Misc/SessionParameter.h"
 #include "../Misc/VieVS_Object.h"
 #include "../Misc/util.h"
 #include "PointingVector.h"
@@ -49,6 +51,14 @@ namespace VieVS {
  */
 class ScanTimes : public VieVS_Object {
    public:
+    static constexpr std::size_t nInlineStations = 32;  ///< number of stations stored without heap allocation
+
+    /**
+     * @brief per station times, stored inline for typical network sizes
+     * @author Matthias Schartner
+     */
+    using TimeVector = boost::container::small_vector<unsigned int, nInlineStations>;
+
     /**
      * @brief observation time alignment anchor
      * @author Matthias Schartner
@@ -96,7 +106,7 @@ class ScanTimes : public VieVS_Object {
      * @param endOfLastScan end time of last scan in seconds since session start
      */
     void setEndOfLastScan( const std::vector<unsigned int> &endOfLastScan ) noexcept {
-        ScanTimes::endOfLastScan_ = endOfLastScan;
+        ScanTimes::endOfLastScan_.assign( endOfLastScan.begin(), endOfLastScan.end() );
     }
 
 
@@ -158,7 +168,9 @@ class ScanTimes : public VieVS_Object {
      *
      * @return end of slew times for each station
      */
-    const std::vector<unsigned int> getEndOfSlewTimes() const noexcept { return endOfSlewTime_; }
+    const std::vector<unsigned int> getEndOfSlewTimes() const noexcept {
+        return std::vector<unsigned int>( endOfSlewTime_.begin(), endOfSlewTime_.end() );
+    }
 
 
     /**
@@ -407,13 +419,13 @@ class ScanTimes : public VieVS_Object {
     unsigned int getObservingTime( Timestamp ts = Timestamp::start ) const noexcept {
         switch ( ts ) {
             case Timestamp::start: {
-                return *min_element( endOfPreobTime_.begin(), endOfPreobTime_.end() );
+                return *std::min_element( endOfPreobTime_.begin(), endOfPreobTime_.end() );
             }
             case Timestamp::end: {
-                return *max_element( endOfObservingTime_.begin(), endOfObservingTime_.end() );
+                return *std::max_element( endOfObservingTime_.begin(), endOfObservingTime_.end() );
             }
             default:
-                return *min_element(endOfPreobTime_.begin(), endOfPreobTime_.end());
+                return *std::min_element(endOfPreobTime_.begin(), endOfPreobTime_.end());
         }
     }
 
@@ -428,13 +440,13 @@ class ScanTimes : public VieVS_Object {
     unsigned int getScanTime( Timestamp ts = Timestamp::start ) const noexcept {
         switch ( ts ) {
             case Timestamp::start: {
-                return *min_element( endOfLastScan_.begin(), endOfLastScan_.end() );
+                return *std::min_element( endOfLastScan_.begin(), endOfLastScan_.end() );
             }
             case Timestamp::end: {
-                return *max_element( endOfObservingTime_.begin(), endOfObservingTime_.end() );
+                return *std::max_element( endOfObservingTime_.begin(), endOfObservingTime_.end() );
             }
             default:
-                return *min_element(endOfLastScan_.begin(), endOfLastScan_.end());
+                return *std::min_element(endOfLastScan_.begin(), endOfLastScan_.end());
         }
     }
 
@@ -563,18 +575,18 @@ class ScanTimes : public VieVS_Object {
 
 
    private:
-    static unsigned long nextId;    ///< next id for this object type
-    static AlignmentAnchor anchor;  ///< scan alignment anchor
+    static unsigned long nextId;                 ///< next id for this object type
+    static thread_local SessionParameter<AlignmentAnchor> anchor;  ///< scan alignment anchor
 
-    std::vector<unsigned int> endOfLastScan_;         ///< end of last scan
-    std::vector<unsigned int> endOfFieldSystemTime_;  ///< end of setup time
-    std::vector<unsigned int> endOfSlewTime_;         ///< end of slew time
-    std::vector<unsigned int> endOfIdleTime_;         ///< end of idle time
-    std::vector<unsigned int> endOfPreobTime_;        ///< end of preob time
-    std::vector<unsigned int> endOfObservingTime_;    ///< end of scan time
+    TimeVector endOfLastScan_;         ///< end of last scan
+    TimeVector endOfFieldSystemTime_;  ///< end of setup time
+    TimeVector endOfSlewTime_;         ///< end of slew time
+    TimeVector endOfIdleTime_;         ///< end of idle time
+    TimeVector endOfPreobTime_;        ///< end of preob time
+    TimeVector endOfObservingTime_;    ///< end of scan time
 
     // TODO: implement endOfPostobTime_
-    std::vector<unsigned int> endOfPostobTime_;  ///< end of postob time
+    TimeVector endOfPostobTime_;  ///< end of postob time
 
     /**
      * @brief remove idle times
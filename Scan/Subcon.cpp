@@ -25,10 +25,13 @@
 
 #include "Subcon.h"
 
+#include "../Misc/SchedulingContext.h"
+
 
 using namespace std;
 using namespace VieVS;
 unsigned long Subcon::nextId = 0;
+unsigned int Subcon::speculativeCandidates = 0;
 
 
 Subcon::Subcon() : VieVS_Object( nextId++ ), nSingleScans_{ 0 }, nSubnettingScans_{ 0 } {}
@@ -345,6 +348,7 @@ void Subcon::createSubnettingScans( const std::shared_ptr<Subnetting> &subnettin
             ++availableSta;
         }
     }
+    unsigned long maxSplits = subnetting->getMaxSplits();
 
     for ( int i = 0; i < nSingleScans_; ++i ) {
         unsigned long firstSrcId = sourceIds[i];
@@ -394,88 +398,117 @@ void Subcon::createSubnettingScans( const std::shared_ptr<Subnetting> &subnettin
                     continue;
                 }
 
+                // scan end times do not depend on the distribution of the shared stations
+                unsigned int firstTime = first.getTimes().getScanTime( Timestamp::end );
+                unsigned int secondTime = second.getTimes().getScanTime( Timestamp::end );
+                if ( util::absDiff( firstTime, secondTime ) > 600 ) {
+                    continue;
+                }
+
+                const auto &firstSource = sourceList.getSource( firstSrcId );
+                const auto &secondSource = sourceList.getSource( secondSrcId );
                 unsigned long nint = intersection.size();
 
-                for ( int igroup = 0; igroup <= nint; ++igroup ) {
-                    vector<int> data( nint, 1 );
-                    for ( unsigned long ii = nint - igroup; ii < nint; ++ii ) {
-                        data.at( ii ) = 2;
+                // required stations are fixed to their scan
+                SubnettingSplitSearch search;
+                search.forced.assign( nint, 0 );
+                bool possible = true;
+                for ( unsigned long staid : firstSource->getPARA().requiredStations ) {
+                    auto itSta = find( intersection.begin(), intersection.end(), staid );
+                    if ( itSta != intersection.end() ) {
+                        search.forced[distance( intersection.begin(), itSta )] = 1;
+                    } else if ( find( uniqueSta1.begin(), uniqueSta1.end(), staid ) == uniqueSta1.end() ) {
+                        possible = false;
                     }
+                }
+                for ( unsigned long staid : secondSource->getPARA().requiredStations ) {
+                    auto itSta = find( intersection.begin(), intersection.end(), staid );
+                    if ( itSta != intersection.end() ) {
+                        long idx = distance( intersection.begin(), itSta );
+                        if ( search.forced[idx] == 1 ) {
+                            possible = false;
+                        }
+                        search.forced[idx] = 2;
+                    } else if ( find( uniqueSta2.begin(), uniqueSta2.end(), staid ) == uniqueSta2.end() ) {
+                        possible = false;
+                    }
+                }
+                if ( !possible ) {
+                    continue;
+                }
+
+                const map<unsigned long, int> &station2site = Network::stations2sites();
+                auto siteOf = [&station2site]( unsigned long staid ) {
+                    auto itSite = station2site.find( staid );
+                    return itSite != station2site.end() ? itSite->second : 0;
+                };
+                for ( unsigned long staid : uniqueSta1 ) {
+                    SubnettingSplitSearch::addSite( search.count1, search.nSites1, siteOf( staid ) );
+                }
+                for ( unsigned long staid : uniqueSta2 ) {
+                    SubnettingSplitSearch::addSite( search.count2, search.nSites2, siteOf( staid ) );
+                }
+                for ( unsigned long staid : intersection ) {
+                    search.sites.push_back( siteOf( staid ) );
+                }
+                search.minSites1 = static_cast<int>( firstSource->getPARA().minNumberOfSites );
+                search.minSites2 = static_cast<int>( secondSource->getPARA().minNumberOfSites );
+                search.assignment.resize( nint );
+
+                // number of shared stations observing the second source
+                vector<unsigned long> groupSizes( nint + 1 );
+                iota( groupSizes.begin(), groupSizes.end(), 0 );
+                if ( maxSplits > 0 ) {
+                    // upper bound of score: number of observations, which only depends on the group size
+                    auto nObs = [&]( unsigned long nGroup2 ) {
+                        unsigned long n1 = uniqueSta1.size() + nint - nGroup2;
+                        unsigned long n2 = uniqueSta2.size() + nGroup2;
+                        return n1 * ( n1 - 1 ) / 2 + n2 * ( n2 - 1 ) / 2;
+                    };
+                    stable_sort( groupSizes.begin(), groupSizes.end(),
+                                 [&nObs]( unsigned long a, unsigned long b ) { return nObs( a ) > nObs( b ); } );
+                    search.limit = maxSplits;
+                }
+                for ( unsigned long igroup : groupSizes ) {
+                    search.search( 0, igroup );
+                }
+                if ( maxSplits > 0 ) {
+                    // restore order of unlimited search
+                    stable_sort( search.splits.begin(), search.splits.end(),
+                                 []( const vector<char> &a, const vector<char> &b ) {
+                                     return count( a.begin(), a.end(), 2 ) < count( b.begin(), b.end(), 2 );
+                                 } );
+                }
 
-                    do {
-                        vector<unsigned long> scan1sta{ uniqueSta1 };
-                        vector<unsigned long> scan2sta{ uniqueSta2 };
-                        for ( unsigned long ii = 0; ii < nint; ++ii ) {
-                            if ( data.at( ii ) == 1 ) {
-                                scan1sta.push_back( intersection[ii] );
-                            } else {
-                                scan2sta.push_back( intersection[ii] );
-                            }
+                for ( const auto &split : search.splits ) {
+                    vector<unsigned long> scan1sta{ uniqueSta1 };
+                    vector<unsigned long> scan2sta{ uniqueSta2 };
+                    for ( unsigned long ii = 0; ii < nint; ++ii ) {
+                        if ( split[ii] == 1 ) {
+                            scan1sta.push_back( intersection[ii] );
+                        } else {
+                            scan2sta.push_back( intersection[ii] );
                         }
+                    }
+
+                    boost::optional<Scan> new_first = first.copyScan( scan1sta, firstSource );
+                    if ( !new_first ) {
+                        continue;
+                    }
 
-                        //                                                === VR2301 ===
-                        //                        unsigned long independent_sta1 = scan1sta.size();
-                        //                        unsigned long independent_sta2 = scan2sta.size();
-                        //                        unsigned long staid_oe = network.getStation("ONSA13NE").getId();
-                        //                        unsigned long staid_ow = network.getStation("ONSA13SW").getId();
-                        //
-                        //                        if ( find_if(scan1sta.begin(), scan1sta.end(), [staid_oe](unsigned
-                        //                        long staid){return staid == staid_oe;}) != scan1sta.end() &&
-                        //                             find_if(scan1sta.begin(), scan1sta.end(), [staid_ow](unsigned
-                        //                             long staid){return staid == staid_ow;}) != scan1sta.end()){
-                        //                            --independent_sta1;
-                        //                        }
-                        //                        if ( find_if(scan2sta.begin(), scan2sta.end(), [staid_oe](unsigned
-                        //                        long staid){return staid == staid_oe;}) != scan2sta.end() &&
-                        //                             find_if(scan2sta.begin(), scan2sta.end(), [staid_ow](unsigned
-                        //                             long staid){return staid == staid_ow;}) != scan2sta.end()){
-                        //                            --independent_sta2;
-                        //                        }
-                        //
-                        //
-                        //                        if ( independent_sta1 >= sourceList.getSource( firstSrcId
-                        //                        )->getPARA().minNumberOfSites &&
-                        //                             independent_sta2 >= sourceList.getSource( secondSrcId
-                        //                             )->getPARA().minNumberOfSites ) {
-                        //                          === INSTEAD OF ===
-                        if ( Network::stationIdsToNSites( scan1sta ) >=
-                                 sourceList.getSource( firstSrcId )->getPARA().minNumberOfSites &&
-                             Network::stationIdsToNSites( scan2sta ) >=
-                                 sourceList.getSource( secondSrcId )->getPARA().minNumberOfSites ) {
-                            //                          === END OF VR2301 ===
-                            unsigned int firstTime = first.getTimes().getScanTime( Timestamp::end );
-                            unsigned int secondTime = second.getTimes().getScanTime( Timestamp::end );
-
-                            if ( util::absDiff( firstTime, secondTime ) > 600 ) {
-                                continue;
-                            }
-
-                            boost::optional<Scan> new_first =
-                                first.copyScan( scan1sta, sourceList.getSource( firstSrcId ) );
-                            if ( !new_first ) {
-                                continue;
-                            }
-
-                            boost::optional<Scan> new_second =
-                                second.copyScan( scan2sta, sourceList.getSource( secondSrcId ) );
-                            if ( !new_second ) {
-                                continue;
-                            }
+                    boost::optional<Scan> new_second = second.copyScan( scan2sta, secondSource );
+                    if ( !new_second ) {
+                        continue;
+                    }
 
 #ifdef VIESCHEDPP_LOG
-                            if ( Flags::logDebug )
-                                BOOST_LOG_TRIVIAL( debug )
-                                    << "subcon " << this->printId() << " add subnetting scans with "
-                                    << new_first->printId() << " and " << new_second->printId();
+                    if ( Flags::logDebug )
+                        BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " add subnetting scans with "
+                                                   << new_first->printId() << " and " << new_second->printId();
 #endif
 
-                            ++nSubnettingScans_;
-                            pair<Scan, Scan> tmp = make_pair( move( *new_first ), move( *new_second ) );
-                            //                            tmp.first = ;
-                            //                            tmp.second = ;
-                            subnettingScans_.push_back( move( tmp ) );
-                        }
-                    } while ( next_permutation( std::begin( data ), std::end( data ) ) );
+                    ++nSubnettingScans_;
+                    subnettingScans_.emplace_back( move( *new_first ), move( *new_second ) );
                 }
             }
         }
@@ -483,6 +516,39 @@ void Subcon::createSubnettingScans( const std::shared_ptr<Subnetting> &subnettin
 }
 
 
+void Subcon::SubnettingSplitSearch::search( unsigned long idx, unsigned long nGroup2 ) {
+    if ( limit > 0 && splits.size() >= limit ) {
+        return;
+    }
+
+    unsigned long nint = sites.size();
+    unsigned long nGroup1 = nint - idx - nGroup2;
+
+    // each remaining station adds at most one site
+    if ( nSites1 + static_cast<long>( nGroup1 ) < minSites1 || nSites2 + static_cast<long>( nGroup2 ) < minSites2 ) {
+        return;
+    }
+    if ( idx == nint ) {
+        splits.push_back( assignment );
+        return;
+    }
+
+    int site = sites[idx];
+    if ( nGroup1 > 0 && forced[idx] != 2 ) {
+        assignment[idx] = 1;
+        addSite( count1, nSites1, site );
+        search( idx + 1, nGroup2 );
+        removeSite( count1, nSites1, site );
+    }
+    if ( nGroup2 > 0 && forced[idx] != 1 ) {
+        assignment[idx] = 2;
+        addSite( count2, nSites2, site );
+        search( idx + 1, nGroup2 - 1 );
+        removeSite( count2, nSites2, site );
+    }
+}
+
+
 void Subcon::generateScore( const Network &network, const SourceList &sourceList ) noexcept {
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " generate scores ";
@@ -886,6 +952,26 @@ vector<Scan> Subcon::selectBest( Network &network, const SourceList &sourceList,
     }
     vector<unsigned long> scansToRemove;
 
+    // The first rigorous update of a candidate only depends on the state before this scan selection. Therefore, the
+    // next best candidates can be updated in advance in parallel. The results are only used once the serial loop
+    // below reaches the candidate, which keeps the selected scan(s) identical to the serial version.
+    bool speculative = false;
+#ifdef _OPENMP
+    speculative = speculativeCandidates > 1 && omp_get_max_threads() > 1 && !omp_in_parallel();
+#endif
+    vector<char> updated( scores.size(), false );
+    unordered_map<unsigned long, SpeculativeEvaluation> speculativeResults;
+
+    // satellite positions are propagated with a shared SGP4 state - satellites are always updated serially
+    auto isSatellite = [this, &sourceList]( unsigned long i ) {
+        if ( i < nSingleScans_ ) {
+            return sourceList.isSatellite( singleScans_[i].getSourceId() );
+        }
+        const auto &thisScans = subnettingScans_[i - nSingleScans_];
+        return sourceList.isSatellite( thisScans.first.getSourceId() ) ||
+               sourceList.isSatellite( thisScans.second.getSourceId() );
+    };
+
     // loop through queue
     unsigned long idx;
     while ( true ) {
@@ -897,192 +983,59 @@ vector<Scan> Subcon::selectBest( Network &network, const SourceList &sourceList,
         idx = q.top().second;
         q.pop();
 
-        // distinguish between single source scan and subnetting scans
-        if ( idx < nSingleScans_ ) {
-            unsigned long thisIdx = idx;
-
-            // get scan with highest score
-            Scan &thisScan = singleScans_[thisIdx];
-#ifdef VIESCHEDPP_LOG
-            if ( Flags::logDebug )
-                BOOST_LOG_TRIVIAL( debug )
-                    << "subcon " << this->printId() << " highest score for scan " << thisScan.printId();
-#endif
-
-            const auto &thisSource = sourceList.getSource( thisScan.getSourceId() );
-            // make rigorous update
-            bool flag = thisScan.rigorousUpdate( network, thisSource, mode, endposition );
-            if ( !flag ) {
-                scansToRemove.push_back( idx );
-#ifdef VIESCHEDPP_LOG
-                if ( Flags::logDebug )
-                    BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan.printId()
-                                               << " no longer valid -> removed";
-#endif
-                continue;
-            }
-
-            // calculate score again
-            if ( thisScan.getType() == Scan::ScanType::astroCalibrator ) {
-                // special case for calibrator block
-                bool valid = thisScan.calcScore( prevLowElevationScores, prevHighElevationScores, network,
-                                                 minRequiredTime_, maxRequiredTime_, thisSource, false );
-
-                if ( !valid ) {
-                    scansToRemove.push_back( idx );
-#ifdef VIESCHEDPP_LOG
-                    if ( Flags::logDebug )
-                        BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan.printId()
-                                                   << " no longer valid -> removed";
-#endif
-                    continue;
-                }
-            } else if ( thisScan.getType() == Scan::ScanType::fringeFinder ) {
-                double meanSNR = thisScan.getAverageSNR( network, thisSource, mode );
-                thisScan.calcScoreCalibrator( network, thisSource, astas_, abls_, meanSNR, minRequiredTime_,
-                                              maxRequiredTime_ );
-                if ( CalibratorBlock::tryToIncludeAllStationFlag ) {
-                    checkCalibratorScores( thisScan );
+        Evaluation evaluation;
+        if ( speculative && !updated[idx] && !isSatellite( idx ) ) {
+            auto it = speculativeResults.find( idx );
+            if ( it == speculativeResults.end() ) {
+                // collect next best candidates which were not updated yet
+                vector<unsigned long> candidates{ idx };
+                auto nextBest = q;
+                while ( candidates.size() < speculativeCandidates && !nextBest.empty() ) {
+                    unsigned long candidate = nextBest.top().second;
+                    nextBest.pop();
+                    if ( !updated[candidate] && speculativeResults.find( candidate ) == speculativeResults.end() &&
+                         !isSatellite( candidate ) ) {
+                        candidates.push_back( candidate );
+                    }
                 }
+                speculativeEvaluation( candidates, network, sourceList, mode, prevLowElevationScores,
+                                       prevHighElevationScores, endposition, speculativeResults );
+                it = speculativeResults.find( idx );
+            }
 
-            } else if ( thisScan.getType() == Scan::ScanType::parallacticAngle ) {
-                double meanSNR = thisScan.getAverageSNR( network, thisSource, mode );
-                thisScan.calcScorePar( network, thisSource, meanSNR );
-
-            } else if ( thisScan.getType() == Scan::ScanType::diffParallacticAngle ) {
-                vector<double> snrs = thisScan.getSNRs( network, thisSource, mode );
-                thisScan.calcScoreDPar( network, thisSource, snrs );
-
+            // take over updated scan(s)
+            if ( idx < nSingleScans_ ) {
+                singleScans_[idx] = std::move( it->second.scans[0] );
             } else {
-                // standard case
-                thisScan.calcScore( astas_, asrcs_, abls_, minRequiredTime_, maxRequiredTime_, network, thisSource,
-                                    false, idle_ );
+                auto &thisScans = subnettingScans_[idx - nSingleScans_];
+                thisScans.first = std::move( it->second.scans[0] );
+                thisScans.second = std::move( it->second.scans[1] );
             }
+            evaluation = it->second.evaluation;
+            speculativeResults.erase( it );
 
-            // push score in queue
-            q.push( make_pair( thisScan.getScore(), idx ) );
-
+        } else if ( idx < nSingleScans_ ) {
+            // distinguish between single source scan and subnetting scans
+            evaluation = evaluateSingleSourceScan( singleScans_[idx], network, sourceList, mode, prevLowElevationScores,
+                                                   prevHighElevationScores, endposition );
         } else {
-            unsigned long thisIdx = idx - nSingleScans_;
-            auto &thisScans = subnettingScans_[thisIdx];
-
-            // get scans with highest score
-            Scan &thisScan1 = thisScans.first;
-            const auto &thisSource1 = sourceList.getSource( thisScan1.getSourceId() );
-            Scan &thisScan2 = thisScans.second;
-            const auto &thisSource2 = sourceList.getSource( thisScan2.getSourceId() );
-
-#ifdef VIESCHEDPP_LOG
-            if ( Flags::logDebug )
-                BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " highest score for scan "
-                                           << thisScan1.printId() << " and " << thisScan2.printId();
-#endif
-
-            // make rigorous update
-            bool flag1 = thisScan1.rigorousUpdate( network, thisSource1, mode, endposition );
-            if ( !flag1 ) {
-                scansToRemove.push_back( idx );
-#ifdef VIESCHEDPP_LOG
-                if ( Flags::logDebug )
-                    BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan1.printId()
-                                               << " no longer valid -> removed";
-#endif
-
-                continue;
-            }
-            bool flag2 = thisScan2.rigorousUpdate( network, thisSource2, mode, endposition );
-            if ( !flag2 ) {
-                scansToRemove.push_back( idx );
-#ifdef VIESCHEDPP_LOG
-                if ( Flags::logDebug )
-                    BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan2.printId()
-                                               << " no longer valid -> removed";
-#endif
-                continue;
-            }
-
-            // check time differences between subnetting scans
-            unsigned int maxTime1 = thisScan1.getTimes().getScanTime( Timestamp::end );
-            unsigned int maxTime2 = thisScan2.getTimes().getScanTime( Timestamp::end );
-            unsigned int deltaTime = util::absDiff( maxTime1, maxTime2 );
-            if ( deltaTime > 600 ) {
-#ifdef VIESCHEDPP_LOG
-                if ( Flags::logDebug )
-                    BOOST_LOG_TRIVIAL( debug )
-                        << "subcon " << this->printId() << " too much time between subnetting scans -> removed";
-#endif
-                continue;
-            }
-
-            // calculate score again
-            if ( thisScan1.getType() == Scan::ScanType::astroCalibrator ) {
-                // special case for calibrator block
-                bool valid1 = thisScan1.calcScore( prevLowElevationScores, prevHighElevationScores, network,
-                                                   minRequiredTime_, maxRequiredTime_, thisSource1, true );
-
-                bool valid2 = thisScan2.calcScore( prevLowElevationScores, prevHighElevationScores, network,
-                                                   minRequiredTime_, maxRequiredTime_, thisSource2, true );
-
-                if ( !valid1 || !valid2 ) {
-                    scansToRemove.push_back( idx );
-#ifdef VIESCHEDPP_LOG
-                    if ( Flags::logDebug )
-                        BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan1.printId()
-                                                   << " and " << thisScan2.printId() << " no longer valid -> removed";
-#endif
-                    continue;
-                }
-            } else if ( thisScan1.getType() == Scan::ScanType::fringeFinder ) {
-                double meanSNR1 = thisScan1.getAverageSNR( network, thisSource1, mode );
-                thisScan1.calcScoreCalibrator( network, thisSource1, astas_, abls_, meanSNR1, minRequiredTime_,
-                                               maxRequiredTime_ );
-
-                double meanSNR2 = thisScan2.getAverageSNR( network, thisSource2, mode );
-                thisScan2.calcScoreCalibrator( network, thisSource2, astas_, abls_, meanSNR2, minRequiredTime_,
-                                               maxRequiredTime_ );
-
-                if ( CalibratorBlock::tryToIncludeAllStationFlag ) {
-                    checkCalibratorScores( thisScan1, thisScan2 );
-                }
-            } else if ( thisScan1.getType() == Scan::ScanType::parallacticAngle ) {
-                double meanSNR1 = thisScan1.getAverageSNR( network, thisSource1, mode );
-                thisScan1.calcScorePar( network, thisSource1, meanSNR1 );
-
-                double meanSNR2 = thisScan2.getAverageSNR( network, thisSource2, mode );
-                thisScan2.calcScorePar( network, thisSource1, meanSNR2 );
-
-            } else if ( thisScan1.getType() == Scan::ScanType::diffParallacticAngle ) {
-                vector<double> snrs1 = thisScan1.getSNRs( network, thisSource1, mode );
-                thisScan1.calcScoreDPar( network, thisSource1, snrs1 );
-
-                vector<double> snrs2 = thisScan1.getSNRs( network, thisSource2, mode );
-                thisScan2.calcScoreDPar( network, thisSource2, snrs2 );
-
-            } else {
-                // standard case
-                thisScan1.calcScore( astas_, asrcs_, abls_, minRequiredTime_, maxRequiredTime_, network, thisSource1,
-                                     true, idle_ );
-                thisScan2.calcScore( astas_, asrcs_, abls_, minRequiredTime_, maxRequiredTime_, network, thisSource2,
-                                     true, idle_ );
-            }
+            auto &thisScans = subnettingScans_[idx - nSingleScans_];
+            evaluation = evaluateSubnettingScans( thisScans.first, thisScans.second, network, sourceList, mode,
+                                                  prevLowElevationScores, prevHighElevationScores, endposition );
+        }
+        updated[idx] = true;
 
-            // push score in queue
-            //            === VR2302 ===
-            //            unsigned long staid_oe = network.getStation("ONSA13NE").getId();
-            //            unsigned long staid_ow = network.getStation("ONSA13SW").getId();
-            //            double factor = 1;
-            //            if ( ( thisScan1.findIdxOfStationId(staid_oe).is_initialized() &&
-            //                   thisScan2.findIdxOfStationId(staid_ow).is_initialized()) ||
-            //                 ( thisScan1.findIdxOfStationId(staid_ow).is_initialized() &&
-            //                   thisScan2.findIdxOfStationId(staid_oe).is_initialized()) ){
-            //                factor = 2;
-            //            }
-            //            q.push( make_pair( (thisScan1.getScore() + thisScan2.getScore()) * factor, idx ) );
-            //            === instead of ===
-            q.push( make_pair( thisScan1.getScore() + thisScan2.getScore(), idx ) );
-            //            === end of VR2302 ===
+        if ( evaluation.invalid ) {
+            scansToRemove.push_back( idx );
+            continue;
+        }
+        if ( !evaluation.score.is_initialized() ) {
+            continue;
         }
 
+        // push score in queue
+        q.push( make_pair( *evaluation.score, idx ) );
+
         // check if newly added score is again the highest score in the queue. If yes this is/are our selected
         // scan/scans
         unsigned long newIdx = q.top().second;
@@ -1133,6 +1086,250 @@ vector<Scan> Subcon::selectBest( Network &network, const SourceList &sourceList,
 }
 
 
+Subcon::Evaluation Subcon::evaluateSingleSourceScan( Scan &thisScan, Network &network, const SourceList &sourceList,
+                                                     const std::shared_ptr<const Mode> &mode,
+                                                     const std::vector<double> &prevLowElevationScores,
+                                                     const std::vector<double> &prevHighElevationScores,
+                                                     const boost::optional<StationEndposition> &endposition ) const
+    noexcept {
+    Evaluation evaluation;
+#ifdef VIESCHEDPP_LOG
+    if ( Flags::logDebug )
+        BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " highest score for scan " << thisScan.printId();
+#endif
+
+    const auto &thisSource = sourceList.getSource( thisScan.getSourceId() );
+    // make rigorous update
+    bool flag = thisScan.rigorousUpdate( network, thisSource, mode, endposition );
+    if ( !flag ) {
+        evaluation.invalid = true;
+#ifdef VIESCHEDPP_LOG
+        if ( Flags::logDebug )
+            BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan.printId()
+                                       << " no longer valid -> removed";
+#endif
+        return evaluation;
+    }
+
+    // calculate score again
+    if ( thisScan.getType() == Scan::ScanType::astroCalibrator ) {
+        // special case for calibrator block
+        bool valid = thisScan.calcScore( prevLowElevationScores, prevHighElevationScores, network, minRequiredTime_,
+                                         maxRequiredTime_, thisSource, false );
+
+        if ( !valid ) {
+            evaluation.invalid = true;
+#ifdef VIESCHEDPP_LOG
+            if ( Flags::logDebug )
+                BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan.printId()
+                                           << " no longer valid -> removed";
+#endif
+            return evaluation;
+        }
+    } else if ( thisScan.getType() == Scan::ScanType::fringeFinder ) {
+        double meanSNR = thisScan.getAverageSNR( network, thisSource, mode );
+        thisScan.calcScoreCalibrator( network, thisSource, astas_, abls_, meanSNR, minRequiredTime_,
+                                      maxRequiredTime_ );
+        if ( CalibratorBlock::tryToIncludeAllStationFlag ) {
+            checkCalibratorScores( thisScan );
+        }
+
+    } else if ( thisScan.getType() == Scan::ScanType::parallacticAngle ) {
+        double meanSNR = thisScan.getAverageSNR( network, thisSource, mode );
+        thisScan.calcScorePar( network, thisSource, meanSNR );
+
+    } else if ( thisScan.getType() == Scan::ScanType::diffParallacticAngle ) {
+        vector<double> snrs = thisScan.getSNRs( network, thisSource, mode );
+        thisScan.calcScoreDPar( network, thisSource, snrs );
+
+    } else {
+        // standard case
+        thisScan.calcScore( astas_, asrcs_, abls_, minRequiredTime_, maxRequiredTime_, network, thisSource, false,
+                            idle_ );
+    }
+
+    evaluation.score = thisScan.getScore();
+    return evaluation;
+}
+
+
+Subcon::Evaluation Subcon::evaluateSubnettingScans( Scan &thisScan1, Scan &thisScan2, Network &network,
+                                                    const SourceList &sourceList,
+                                                    const std::shared_ptr<const Mode> &mode,
+                                                    const std::vector<double> &prevLowElevationScores,
+                                                    const std::vector<double> &prevHighElevationScores,
+                                                    const boost::optional<StationEndposition> &endposition ) const
+    noexcept {
+    Evaluation evaluation;
+
+    // get scans with highest score
+    const auto &thisSource1 = sourceList.getSource( thisScan1.getSourceId() );
+    const auto &thisSource2 = sourceList.getSource( thisScan2.getSourceId() );
+
+#ifdef VIESCHEDPP_LOG
+    if ( Flags::logDebug )
+        BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " highest score for scan " << thisScan1.printId()
+                                   << " and " << thisScan2.printId();
+#endif
+
+    // make rigorous update
+    bool flag1 = thisScan1.rigorousUpdate( network, thisSource1, mode, endposition );
+    if ( !flag1 ) {
+        evaluation.invalid = true;
+#ifdef VIESCHEDPP_LOG
+        if ( Flags::logDebug )
+            BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan1.printId()
+                                       << " no longer valid -> removed";
+#endif
+        return evaluation;
+    }
+    bool flag2 = thisScan2.rigorousUpdate( network, thisSource2, mode, endposition );
+    if ( !flag2 ) {
+        evaluation.invalid = true;
+#ifdef VIESCHEDPP_LOG
+        if ( Flags::logDebug )
+            BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan2.printId()
+                                       << " no longer valid -> removed";
+#endif
+        return evaluation;
+    }
+
+    // check time differences between subnetting scans
+    unsigned int maxTime1 = thisScan1.getTimes().getScanTime( Timestamp::end );
+    unsigned int maxTime2 = thisScan2.getTimes().getScanTime( Timestamp::end );
+    unsigned int deltaTime = util::absDiff( maxTime1, maxTime2 );
+    if ( deltaTime > 600 ) {
+#ifdef VIESCHEDPP_LOG
+        if ( Flags::logDebug )
+            BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId()
+                                       << " too much time between subnetting scans -> removed";
+#endif
+        return evaluation;
+    }
+
+    // calculate score again
+    if ( thisScan1.getType() == Scan::ScanType::astroCalibrator ) {
+        // special case for calibrator block
+        bool valid1 = thisScan1.calcScore( prevLowElevationScores, prevHighElevationScores, network, minRequiredTime_,
+                                           maxRequiredTime_, thisSource1, true );
+
+        bool valid2 = thisScan2.calcScore( prevLowElevationScores, prevHighElevationScores, network, minRequiredTime_,
+                                           maxRequiredTime_, thisSource2, true );
+
+        if ( !valid1 || !valid2 ) {
+            evaluation.invalid = true;
+#ifdef VIESCHEDPP_LOG
+            if ( Flags::logDebug )
+                BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " scan " << thisScan1.printId() << " and "
+                                           << thisScan2.printId() << " no longer valid -> removed";
+#endif
+            return evaluation;
+        }
+    } else if ( thisScan1.getType() == Scan::ScanType::fringeFinder ) {
+        double meanSNR1 = thisScan1.getAverageSNR( network, thisSource1, mode );
+        thisScan1.calcScoreCalibrator( network, thisSource1, astas_, abls_, meanSNR1, minRequiredTime_,
+                                       maxRequiredTime_ );
+
+        double meanSNR2 = thisScan2.getAverageSNR( network, thisSource2, mode );
+        thisScan2.calcScoreCalibrator( network, thisSource2, astas_, abls_, meanSNR2, minRequiredTime_,
+                                       maxRequiredTime_ );
+
+        if ( CalibratorBlock::tryToIncludeAllStationFlag ) {
+            checkCalibratorScores( thisScan1, thisScan2 );
+        }
+    } else if ( thisScan1.getType() == Scan::ScanType::parallacticAngle ) {
+        double meanSNR1 = thisScan1.getAverageSNR( network, thisSource1, mode );
+        thisScan1.calcScorePar( network, thisSource1, meanSNR1 );
+
+        double meanSNR2 = thisScan2.getAverageSNR( network, thisSource2, mode );
+        thisScan2.calcScorePar( network, thisSource1, meanSNR2 );
+
+    } else if ( thisScan1.getType() == Scan::ScanType::diffParallacticAngle ) {
+        vector<double> snrs1 = thisScan1.getSNRs( network, thisSource1, mode );
+        thisScan1.calcScoreDPar( network, thisSource1, snrs1 );
+
+        vector<double> snrs2 = thisScan1.getSNRs( network, thisSource2, mode );
+        thisScan2.calcScoreDPar( network, thisSource2, snrs2 );
+
+    } else {
+        // standard case
+        thisScan1.calcScore( astas_, asrcs_, abls_, minRequiredTime_, maxRequiredTime_, network, thisSource1, true,
+                             idle_ );
+        thisScan2.calcScore( astas_, asrcs_, abls_, minRequiredTime_, maxRequiredTime_, network, thisSource2, true,
+                             idle_ );
+    }
+
+    // push score in queue
+    //            === VR2302 ===
+    //            unsigned long staid_oe = network.getStation("ONSA13NE").getId();
+    //            unsigned long staid_ow = network.getStation("ONSA13SW").getId();
+    //            double factor = 1;
+    //            if ( ( thisScan1.findIdxOfStationId(staid_oe).is_initialized() &&
+    //                   thisScan2.findIdxOfStationId(staid_ow).is_initialized()) ||
+    //                 ( thisScan1.findIdxOfStationId(staid_ow).is_initialized() &&
+    //                   thisScan2.findIdxOfStationId(staid_oe).is_initialized()) ){
+    //                factor = 2;
+    //            }
+    //            evaluation.score = (thisScan1.getScore() + thisScan2.getScore()) * factor;
+    //            === instead of ===
+    evaluation.score = thisScan1.getScore() + thisScan2.getScore();
+    //            === end of VR2302 ===
+    return evaluation;
+}
+
+
+void Subcon::speculativeEvaluation( const std::vector<unsigned long> &candidates, Network &network,
+                                    const SourceList &sourceList, const std::shared_ptr<const Mode> &mode,
+                                    const std::vector<double> &prevLowElevationScores,
+                                    const std::vector<double> &prevHighElevationScores,
+                                    const boost::optional<StationEndposition> &endposition,
+                                    std::unordered_map<unsigned long, SpeculativeEvaluation> &results ) const noexcept {
+    // copy scan(s) of all candidates
+    vector<SpeculativeEvaluation> evaluations( candidates.size() );
+    for ( unsigned long i = 0; i < candidates.size(); ++i ) {
+        unsigned long idx = candidates[i];
+        if ( idx < nSingleScans_ ) {
+            evaluations[i].scans.push_back( singleScans_[idx] );
+        } else {
+            const auto &thisScans = subnettingScans_[idx - nSingleScans_];
+            evaluations[i].scans.push_back( thisScans.first );
+            evaluations[i].scans.push_back( thisScans.second );
+        }
+    }
+
+    // stations are only read during the parallel section
+    network.setAzElCacheReadOnly( true );
+    SchedulingContext context = SchedulingContext::capture();
+    auto n = static_cast<int>( candidates.size() );
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        SchedulingContext::Scope scope( context );
+#ifdef _OPENMP
+#pragma omp for schedule( dynamic, 1 )
+#endif
+        for ( int i = 0; i < n; ++i ) {
+            auto &thisEvaluation = evaluations[i];
+            if ( thisEvaluation.scans.size() == 1 ) {
+                thisEvaluation.evaluation =
+                    evaluateSingleSourceScan( thisEvaluation.scans[0], network, sourceList, mode,
+                                              prevLowElevationScores, prevHighElevationScores, endposition );
+            } else {
+                thisEvaluation.evaluation = evaluateSubnettingScans(
+                    thisEvaluation.scans[0], thisEvaluation.scans[1], network, sourceList, mode,
+                    prevLowElevationScores, prevHighElevationScores, endposition );
+            }
+        }
+    }
+    network.setAzElCacheReadOnly( false );
+
+    for ( unsigned long i = 0; i < candidates.size(); ++i ) {
+        results[candidates[i]] = std::move( evaluations[i] );
+    }
+}
+
+
 void Subcon::removeScan( unsigned long idx ) noexcept {
     if ( idx < nSingleScans_ ) {
         unsigned long thisIdx = idx;
@@ -1307,9 +1504,10 @@ void Subcon::changeType( const SourceList &sourceList, Scan::ScanType type ) {
 }
 
 
-void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const Network &network,
-                          shared_ptr<const AbstractSource> thisSource, std::set<unsigned long> observedSources,
-                          bool doNotObserveSourcesWithinMinRepeat ) {
+bool Subcon::isSourceAvailable( unsigned int currentTime, Scan::ScanType type,
+                                const shared_ptr<const AbstractSource> &thisSource,
+                                const std::set<unsigned long> &observedSources,
+                                bool doNotObserveSourcesWithinMinRepeat ) const noexcept {
     unsigned long srcid = thisSource->getId();
 
     if ( !thisSource->getPARA().available || !thisSource->getPARA().globalAvailable ) {
@@ -1318,7 +1516,7 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
             BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " source " << thisSource->getName()
                                        << " not available";
 #endif
-        return;
+        return false;
     }
 
     if ( type == Scan::ScanType::fillin && !thisSource->getPARA().availableForFillinmode ) {
@@ -1327,7 +1525,7 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
             BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " source " << thisSource->getName()
                                        << " not available for fillin mode";
 #endif
-        return;
+        return false;
     }
 
     if ( type == Scan::ScanType::astroCalibrator &&
@@ -1339,7 +1537,7 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
             BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " source " << thisSource->getName()
                                        << " not available as calibrator";
 #endif
-        return;
+        return false;
     }
 
     if ( observedSources.find( srcid ) != observedSources.end() ) {
@@ -1348,7 +1546,7 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
             BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " source " << thisSource->getName()
                                        << " not available - already observed in next scans";
 #endif
-        return;
+        return false;
     }
 
     if ( thisSource->getNscans() > 0 && doNotObserveSourcesWithinMinRepeat &&
@@ -1358,7 +1556,7 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
             BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " source " << thisSource->getName()
                                        << " not available - observed recently";
 #endif
-        return;
+        return false;
     }
 
     if ( thisSource->getNscans() > 0 && type != Scan::ScanType::fringeFinder &&
@@ -1368,7 +1566,7 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
             BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " source " << thisSource->getName()
                                        << " not available - observed recently";
 #endif
-        return;
+        return false;
     }
 
     if ( thisSource->getNscans() >= thisSource->getPARA().maxNumberOfScans ) {
@@ -1377,6 +1575,19 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
             BOOST_LOG_TRIVIAL( debug ) << "subcon " << this->printId() << " source " << thisSource->getName()
                                        << " not available - max number of scans reached";
 #endif
+        return false;
+    }
+
+    return true;
+}
+
+
+void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const Network &network,
+                          shared_ptr<const AbstractSource> thisSource, const std::set<unsigned long> &observedSources,
+                          bool doNotObserveSourcesWithinMinRepeat ) {
+    unsigned long srcid = thisSource->getId();
+
+    if ( !isSourceAvailable( currentTime, type, thisSource, observedSources, doNotObserveSourcesWithinMinRepeat ) ) {
         return;
     }
 
@@ -1511,6 +1722,150 @@ void Subcon::visibleScan( unsigned int currentTime, Scan::ScanType type, const N
 }
 
 
+void Subcon::visibleScans( unsigned int currentTime, Scan::ScanType type, const Network &network,
+                           const SourceList &sourceList, const std::set<unsigned long> &observedSources,
+                           bool doNotObserveSourcesWithinMinRepeat ) {
+    unsigned long nsta = network.getNSta();
+    unsigned long nsrc = sourceList.getNSrc();
+    bool considerIgnoreStations = type != Scan::ScanType::fringeFinder && type != Scan::ScanType::parallacticAngle &&
+                                  type != Scan::ScanType::diffParallacticAngle;
+
+    // station part (independent of source): availability mask, evaluation time and ignored sources
+    unsigned int availableSta = 0;
+    vector<char> staMask( nsta, 0 );
+    vector<unsigned int> staTime( nsta, 0 );
+    vector<double> staMinEl( nsta, 0 );
+    vector<char> ignoreMask;  // nsta x nsrc, only allocated if any station ignores sources
+    for ( const auto &thisSta : network.getStations() ) {
+        unsigned long staid = thisSta.getId();
+        const auto &PARA = thisSta.getPARA();
+
+        if ( ( PARA.available && !PARA.tagalong ) || ( PARA.tagalong && !considerIgnoreStations ) ) {
+            ++availableSta;
+        } else {
+            continue;
+        }
+        if ( thisSta.getTotalObservingTime() + PARA.minScan > PARA.maxTotalObsTime ) {
+            continue;
+        }
+        if ( thisSta.getNTotalScans() >= PARA.maxNumberOfScans ) {
+            continue;
+        }
+
+        staMask[staid] = 1;
+        staMinEl[staid] = PARA.minElevation;
+        if ( PARA.firstScan ) {
+            staTime[staid] = thisSta.getCurrentTime();
+        } else {
+            staTime[staid] = thisSta.getCurrentTime() + PARA.systemDelay + PARA.preob;
+        }
+
+        for ( unsigned long ignoredSrcid : PARA.ignoreSources ) {
+            if ( ignoredSrcid < nsrc ) {
+                if ( ignoreMask.empty() ) {
+                    ignoreMask.resize( nsta * nsrc, 0 );
+                }
+                ignoreMask[staid * nsrc + ignoredSrcid] = 1;
+            }
+        }
+    }
+
+    vector<char> candidate( nsta );
+    vector<PointingVector> pvs;
+    pvs.reserve( nsta );
+    vector<char> visible;
+    visible.reserve( nsta );
+
+    for ( unsigned long srcid = 0; srcid < nsrc; ++srcid ) {
+        const auto &thisSource = sourceList.getSource( srcid );
+        if ( !isSourceAvailable( currentTime, type, thisSource, observedSources,
+                                 doNotObserveSourcesWithinMinRepeat ) ) {
+            continue;
+        }
+        const auto &srcPARA = thisSource->getPARA();
+
+        // candidate mask of this source
+        candidate = staMask;
+        if ( !ignoreMask.empty() ) {
+            for ( unsigned long staid = 0; staid < nsta; ++staid ) {
+                candidate[staid] &= !ignoreMask[staid * nsrc + srcid];
+            }
+        }
+        if ( considerIgnoreStations ) {
+            for ( unsigned long staid : srcPARA.ignoreStations ) {
+                if ( staid < nsta ) {
+                    candidate[staid] = 0;
+                }
+            }
+        }
+
+        // azimuth and elevation of all candidates
+        pvs.clear();
+        for ( unsigned long staid = 0; staid < nsta; ++staid ) {
+            if ( candidate[staid] ) {
+                pvs.emplace_back( staid, srcid );
+                pvs.back().setTime( staTime[staid] );
+                network.getStation( staid ).calcAzEl_simple( thisSource, pvs.back() );
+            }
+        }
+
+        // elevation mask
+        unsigned long n = pvs.size();
+        visible.resize( n );
+        double srcMinEl = srcPARA.minElevation;
+        for ( unsigned long k = 0; k < n; ++k ) {
+            double el = pvs[k].getEl();
+            visible[k] = el >= staMinEl[pvs[k].getStaid()] && el >= srcMinEl;
+        }
+
+        // horizon mask and cable wrap mask only for stations above elevation limit
+        unsigned int visibleSta = 0;
+        for ( unsigned long k = 0; k < n; ++k ) {
+            if ( visible[k] ) {
+                const Station &thisSta = network.getStation( pvs[k].getStaid() );
+                visible[k] = ( !thisSta.hasHorizonMask() || thisSta.getMask().visible( pvs[k] ) ) &&
+                             thisSta.getCableWrap().anglesInside( pvs[k] );
+                visibleSta += visible[k];
+            }
+        }
+
+        vector<unsigned long> visibleSites;
+        visibleSites.reserve( visibleSta );
+        for ( unsigned long k = 0; k < n; ++k ) {
+            if ( visible[k] ) {
+                visibleSites.push_back( pvs[k].getStaid() );
+            }
+        }
+
+        bool requiredStationsVisible = true;
+        for ( unsigned long requiredStationId : srcPARA.requiredStations ) {
+            if ( find( visibleSites.begin(), visibleSites.end(), requiredStationId ) == visibleSites.end() ) {
+                requiredStationsVisible = false;
+                break;
+            }
+        }
+        if ( !requiredStationsVisible ) {
+            continue;
+        }
+
+        if ( Network::stationIdsToNSites( visibleSites ) >= srcPARA.minNumberOfSites ||
+             ( visibleSta == availableSta && availableSta >= 2 ) ) {
+            vector<PointingVector> pointingVectors;
+            pointingVectors.reserve( visibleSta );
+            vector<unsigned int> endOfLastScans;
+            endOfLastScans.reserve( visibleSta );
+            for ( unsigned long k = 0; k < n; ++k ) {
+                if ( visible[k] ) {
+                    endOfLastScans.push_back( network.getStation( pvs[k].getStaid() ).getCurrentTime() );
+                    pointingVectors.push_back( pvs[k] );
+                }
+            }
+            addScan( Scan( pointingVectors, endOfLastScans, type ) );
+        }
+    }
+}
+
+
 void Subcon::checkCalibratorScores( Scan &scan1, Scan &scan2 ) {
     double maxMultiplier = std::count_if( CalibratorBlock::stationFlag.begin(), CalibratorBlock::stationFlag.end(),
                                           []( int val ) { return val == 0; } );
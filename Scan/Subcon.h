@@ -30,11 +30,17 @@
 
 #include <boost/optional.hpp>
 #include <limits>
+#include <map>
 #include <numeric>
 #include <queue>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "../Misc/StationEndposition.h"
 #include "../Misc/Subnetting.h"
 #include "../Source/AbstractSource.h"
@@ -53,6 +59,8 @@ namespace VieVS {
  */
 class Subcon : public VieVS_Object {
    public:
+    static unsigned int speculativeCandidates;  ///< number of best candidates updated in parallel in selectBest()
+
     /**
      * @brief empty default constructor
      * @author Matthias Schartner
@@ -129,6 +137,20 @@ class Subcon : public VieVS_Object {
     }
 
 
+    /**
+     * @brief move all single source scans out of this subcon
+     * @author Matthias Schartner
+     *
+     * @return all single source scans
+     */
+    std::vector<Scan> takeSingleSourceScans() noexcept {
+        std::vector<Scan> tmp = std::move( singleScans_ );
+        singleScans_.clear();
+        nSingleScans_ = 0;
+        return tmp;
+    }
+
+
     /**
      * @brief calculates the earliest possible start time for all single source scans in this subcon
      * @author Matthias Schartner
@@ -353,10 +375,29 @@ class Subcon : public VieVS_Object {
      */
     void visibleScan( unsigned int currentTime, Scan::ScanType type, const Network &network,
                       std::shared_ptr<const AbstractSource> thisSource,
-                      std::set<unsigned long> observedSources = std::set<unsigned long>(),
+                      const std::set<unsigned long> &observedSources = std::set<unsigned long>(),
                       bool doNotObserveSourcesWithinMinRepeat = true );
 
 
+    /**
+     * @brief create possible visible scans to all sources
+     * @author Matthias Schartner
+     *
+     * Equivalent to calling visibleScan() for each source, but station dependent checks are done only once and
+     * visibility of all (source, station) pairs is evaluated with masks before any scan is created.
+     *
+     * @param currentTime current start time
+     * @param type scan type
+     * @param network station network
+     * @param sourceList list of all sources
+     * @param observedSources list of priviously observed sources
+     * @param doNotObserveSourcesWithinMinRepeat consider scans (with reduced weight) if they are within min repeat time
+     */
+    void visibleScans( unsigned int currentTime, Scan::ScanType type, const Network &network,
+                       const SourceList &sourceList, const std::set<unsigned long> &observedSources,
+                       bool doNotObserveSourcesWithinMinRepeat );
+
+
     /**
      * @brief Matthias Schartner
      * @author Matthias Schartner
@@ -417,6 +458,23 @@ class Subcon : public VieVS_Object {
     void precalcScore( const Network &network, const SourceList &sourceList ) noexcept;
 
 
+    /**
+     * @brief check if source is available for a new scan
+     * @author Matthias Schartner
+     *
+     * @param currentTime current start time
+     * @param type scan type
+     * @param thisSource target source
+     * @param observedSources list of priviously observed sources
+     * @param doNotObserveSourcesWithinMinRepeat consider scans (with reduced weight) if they are within min repeat time
+     * @return true if source is available
+     */
+    bool isSourceAvailable( unsigned int currentTime, Scan::ScanType type,
+                            const std::shared_ptr<const AbstractSource> &thisSource,
+                            const std::set<unsigned long> &observedSources,
+                            bool doNotObserveSourcesWithinMinRepeat ) const noexcept;
+
+
     /**
      * @brief pre calculate station average number of observation score
      * @author Matthias Schartner
@@ -465,6 +523,153 @@ class Subcon : public VieVS_Object {
     static void checkCalibratorScores( Scan &scan1 );
 
     static void checkCalibratorScores( Scan &scan1, Scan &scan2 );
+
+
+    /**
+     * @brief depth first search over all distributions of the shared stations of two subnetting scans
+     * @author Matthias Schartner
+     *
+     * Branches which can no longer reach the minimum number of sites of one of the two sources are pruned before any
+     * scan is created. Splits are found in the same order as with next_permutation over all group sizes.
+     */
+    struct SubnettingSplitSearch {
+        std::vector<int> sites;                ///< site of each shared station
+        std::vector<char> forced;              ///< 0 = free, 1 or 2 = required station of first or second source
+        std::map<int, int> count1;             ///< number of stations per site in first scan
+        std::map<int, int> count2;             ///< number of stations per site in second scan
+        int nSites1 = 0;                       ///< number of sites in first scan
+        int nSites2 = 0;                       ///< number of sites in second scan
+        int minSites1 = 0;                     ///< minimum number of sites of first source
+        int minSites2 = 0;                     ///< minimum number of sites of second source
+        unsigned long limit = 0;               ///< stop after this number of splits (0 = no limit)
+        std::vector<char> assignment;          ///< current assignment (1 = first scan, 2 = second scan)
+        std::vector<std::vector<char>> splits;  ///< all found splits
+
+
+        /**
+         * @brief add a site to one scan
+         * @author Matthias Schartner
+         *
+         * @param count number of stations per site
+         * @param nSites number of sites
+         * @param site site id
+         */
+        static void addSite( std::map<int, int> &count, int &nSites, int site ) noexcept {
+            if ( count[site]++ == 0 ) {
+                ++nSites;
+            }
+        }
+
+
+        /**
+         * @brief remove a site from one scan
+         * @author Matthias Schartner
+         *
+         * @param count number of stations per site
+         * @param nSites number of sites
+         * @param site site id
+         */
+        static void removeSite( std::map<int, int> &count, int &nSites, int site ) noexcept {
+            if ( --count[site] == 0 ) {
+                --nSites;
+            }
+        }
+
+
+        /**
+         * @brief search remaining shared stations
+         * @author Matthias Schartner
+         *
+         * @param idx index of next shared station
+         * @param nGroup2 number of remaining stations which go to the second scan
+         */
+        void search( unsigned long idx, unsigned long nGroup2 );
+    };
+
+
+    /**
+     * @brief result of the rigorous update of one candidate in selectBest()
+     * @author Matthias Schartner
+     */
+    struct Evaluation {
+        bool invalid = false;           ///< candidate is no longer valid and has to be removed
+        boost::optional<double> score;  ///< new score (not set if candidate is no longer considered)
+    };
+
+
+    /**
+     * @brief candidate which was updated in advance on a copy of its scan(s)
+     * @author Matthias Schartner
+     */
+    struct SpeculativeEvaluation {
+        Evaluation evaluation;    ///< result of rigorous update
+        std::vector<Scan> scans;  ///< updated scan(s)
+    };
+
+
+    /**
+     * @brief rigorous update and new score of a single source scan
+     * @author Matthias Schartner
+     *
+     * @param thisScan target scan
+     * @param network station network
+     * @param sourceList list of all sources
+     * @param mode observing mode
+     * @param prevLowElevationScores low elevation scores
+     * @param prevHighElevationScores high elevation scores
+     * @param endposition required endposition
+     * @return result of rigorous update
+     */
+    Evaluation evaluateSingleSourceScan( Scan &thisScan, Network &network, const SourceList &sourceList,
+                                         const std::shared_ptr<const Mode> &mode,
+                                         const std::vector<double> &prevLowElevationScores,
+                                         const std::vector<double> &prevHighElevationScores,
+                                         const boost::optional<StationEndposition> &endposition ) const noexcept;
+
+
+    /**
+     * @brief rigorous update and new score of a subnetting scan combination
+     * @author Matthias Schartner
+     *
+     * @param thisScan1 first scan
+     * @param thisScan2 second scan
+     * @param network station network
+     * @param sourceList list of all sources
+     * @param mode observing mode
+     * @param prevLowElevationScores low elevation scores
+     * @param prevHighElevationScores high elevation scores
+     * @param endposition required endposition
+     * @return result of rigorous update
+     */
+    Evaluation evaluateSubnettingScans( Scan &thisScan1, Scan &thisScan2, Network &network,
+                                        const SourceList &sourceList, const std::shared_ptr<const Mode> &mode,
+                                        const std::vector<double> &prevLowElevationScores,
+                                        const std::vector<double> &prevHighElevationScores,
+                                        const boost::optional<StationEndposition> &endposition ) const noexcept;
+
+
+    /**
+     * @brief rigorous update of several candidates in parallel
+     * @author Matthias Schartner
+     *
+     * Each candidate is updated on a copy of its scan(s). Stations are not changed during the parallel section.
+     * Candidates must not observe satellites (SGP4 propagation is not thread safe).
+     *
+     * @param candidates candidate indices (same indexing as removeScan())
+     * @param network station network
+     * @param sourceList list of all sources
+     * @param mode observing mode
+     * @param prevLowElevationScores low elevation scores
+     * @param prevHighElevationScores high elevation scores
+     * @param endposition required endposition
+     * @param results updated candidates (key = candidate index)
+     */
+    void speculativeEvaluation( const std::vector<unsigned long> &candidates, Network &network,
+                                const SourceList &sourceList, const std::shared_ptr<const Mode> &mode,
+                                const std::vector<double> &prevLowElevationScores,
+                                const std::vector<double> &prevHighElevationScores,
+                                const boost::optional<StationEndposition> &endposition,
+                                std::unordered_map<unsigned long, SpeculativeEvaluation> &results ) const noexcept;
 };
 }  // namespace VieVS
 #endif /* SUBCON_H */
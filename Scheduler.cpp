@@ -42,7 +42,8 @@ Scheduler::Scheduler( Initializer &init, string path, string fname )
       multiSchedulingParameters_{ std::move( init.multiSchedulingParameters_ ) },
       xml_{ init.xml_ },
       obsModes_{ init.obsModes_ },
-      currentObservingMode_{ obsModes_->getMode( 0 ) } {
+      currentObservingMode_{ obsModes_->getMode( 0 ) },
+      context_{ SchedulingContext::capture() } {
     if ( init.parameters_.subnetting ) {
         if ( init.parameters_.subnettingMinNStaPercent_otherwiseAllBut ) {
             parameters_.subnetting = make_unique<Subnetting_percent>( init.preCalculated_.subnettingSrcIds,
@@ -51,6 +52,7 @@ Scheduler::Scheduler( Initializer &init, string path, string fname )
             parameters_.subnetting = make_unique<Subnetting_minIdle>( init.preCalculated_.subnettingSrcIds,
                                                                       init.parameters_.subnettingMinNStaAllBut );
         }
+        parameters_.subnetting->setMaxSplits( init.parameters_.subnettingMaxSplits );
     }
 
     parameters_.fillinmodeDuringScanSelection = init.parameters_.fillinmodeDuringScanSelection;
@@ -76,6 +78,7 @@ Scheduler::Scheduler( Initializer &init, string path, string fname )
     parameters_.writeSkyCoverageData = false;
     parameters_.doNotObserveSourcesWithinMinRepeat = init.parameters_.doNotObserveSourcesWithinMinRepeat;
     parameters_.ignoreSuccessiveScansSameSrc = init.parameters_.ignoreSuccessiveScansSameSrc;
+    parameters_.incrementalSubcon = init.parameters_.incrementalSubcon;
 }
 
 
@@ -90,7 +93,8 @@ Scheduler::Scheduler(std::string name, std::string path, Network network, Source
       scans_{ std::move( scans ) },
       obsModes_{ std::move( obsModes_ ) },
       currentObservingMode_{ nullptr },
-      xml_{ xml } {}
+      xml_{ xml },
+      context_{ SchedulingContext::capture() } {}
 
 
 void Scheduler::startScanSelection( unsigned int endTime, std::ofstream &of, Scan::ScanType type,
@@ -116,7 +120,15 @@ void Scheduler::startScanSelection( unsigned int endTime, std::ofstream &of, Sca
         changeStationAvailability( opt_endposition, StationEndposition::change::start );
     }
 
+    // stations might have been changed outside of scan selection
+    if ( depth == 0 ) {
+        candidateCacheValid_ = false;
+    }
+
     while ( true ) {
+        // all candidates of this iteration are allocated from the arena, which is released at the end of the iteration
+        Arena::Scope arenaScope;
+
         // look if station is possible with respect to opt_endposition
         if ( opt_endposition.is_initialized() ) {
             if ( !opt_endposition->checkStationPossibility( network_.getStations() ) ) {
@@ -208,6 +220,7 @@ void Scheduler::startScanSelection( unsigned int endTime, std::ofstream &of, Sca
                 }
 
                 // if there is no more possible scan at the outer most iteration, check 1minute later
+                candidateCacheValid_ = false;
                 unsigned int maxScanEnd = 0;
                 for ( auto &any : network_.refStations() ) {
                     PointingVector pv = any.getCurrentPointingVector();
@@ -262,6 +275,18 @@ void Scheduler::startScanSelection( unsigned int endTime, std::ofstream &of, Sca
             break;
         }
 
+        // report partial statistics, stop if this schedule should be aborted
+        if ( depth == 0 && type == Scan::ScanType::standard && maxScanEnd >= nextCheckpoint_ &&
+             maxScanEnd < TimeSystem::duration ) {
+            if ( !reportCheckpoint( nextCheckpoint_ ) ) {
+                aborted_ = true;
+                break;
+            }
+            while ( nextCheckpoint_ <= maxScanEnd ) {
+                nextCheckpoint_ += checkpointInterval_;
+            }
+        }
+
         // if end time of best possible next scans is greater than end time of scan selection stop
         if ( maxScanEnd > TimeSystem::duration ) {
             int i = 0;
@@ -314,7 +339,7 @@ void Scheduler::startScanSelection( unsigned int endTime, std::ofstream &of, Sca
             boost::optional<Subcon> new_opt_subcon( std::move( subcon ) );
             // start recursion for fillin mode scans
             unsigned long scansBefore = scans_.size();
-            startScanSelection( min( maxScanEnd, TimeSystem::duration ), of, Scan::ScanType::fillin,
+            startScanSelection( min( maxScanEnd, TimeSystem::duration.get() ), of, Scan::ScanType::fillin,
                                 newEndposition, new_opt_subcon, depth + 1 );
 
             // check if a fillin mode scan was created and update times if necessary
@@ -438,6 +463,10 @@ void Scheduler::startScanSelection( unsigned int endTime, std::ofstream &of, Sca
 
 
 void Scheduler::start() noexcept {
+    // session parameters of this schedule (start might be called on another thread than the constructor)
+    if ( parameters_.currentIteration == 0 ) {
+        context_.apply();
+    }
     string prefix = util::version2prefix(version_);
 #ifdef VIESCHEDPP_LOG
     BOOST_LOG_TRIVIAL(info) << prefix << "start scheduling";
@@ -529,7 +558,15 @@ void Scheduler::start() noexcept {
     // check if you have some fixed high impact scans
     if ( scans_.empty() ) {
         // no fixed scans: start creating a schedule
+        if ( checkpointCallback_ && checkpointInterval_ > 0 ) {
+            nextCheckpoint_ = checkpointInterval_;
+        }
         startScanSelection( TimeSystem::duration, of, Scan::ScanType::standard, endposition, subcon, 0 );
+        nextCheckpoint_ = numeric_limits<unsigned int>::max();
+        if ( aborted_ ) {
+            of << "scheduling aborted at checkpoint\n";
+            return;
+        }
 
         // sort scans
         sortSchedule( Timestamp::start );
@@ -630,6 +667,20 @@ void Scheduler::statistics( ofstream &of ) {
 Subcon Scheduler::createSubcon( const shared_ptr<Subnetting> &subnetting, Scan::ScanType type,
                                 const boost::optional<StationEndposition> &endposition ) noexcept {
     Subcon subcon = allVisibleScans( type, endposition, parameters_.doNotObserveSourcesWithinMinRepeat );
+    if ( parameters_.incrementalSubcon && type == Scan::ScanType::standard && !endposition.is_initialized() ) {
+        processIncremental( subcon, endposition );
+    } else {
+        processVisibleScans( subcon, endposition );
+    }
+
+    if ( subnetting != nullptr ) {
+        subcon.createSubnettingScans( subnetting, network_, sourceList_ );
+    }
+    return subcon;
+}
+
+
+void Scheduler::processVisibleScans( Subcon &subcon, const boost::optional<StationEndposition> &endposition ) noexcept {
     subcon.calcStartTimes( network_, sourceList_, endposition );
     subcon.updateAzEl( network_, sourceList_ );
     subcon.constructAllBaselines( network_, sourceList_ );
@@ -637,11 +688,83 @@ Subcon Scheduler::createSubcon( const shared_ptr<Subnetting> &subnetting, Scan::
     subcon.calcAllScanDurations( network_, sourceList_, endposition );
     subcon.checkTotalObservingTime( network_, sourceList_ );
     subcon.checkIfEnoughTimeToReachEndposition( network_, sourceList_, endposition );
+}
 
-    if ( subnetting != nullptr ) {
-        subcon.createSubnettingScans( subnetting, network_, sourceList_ );
+
+void Scheduler::processIncremental( Subcon &subcon, const boost::optional<StationEndposition> &endposition ) noexcept {
+    unsigned long nsrc = sourceList_.getNSrc();
+
+    // stations and sources which were part of a scan since the cache was created
+    vector<char> touchedStations( network_.getNSta(), false );
+    vector<char> touchedSources( nsrc, false );
+    if ( scans_.size() < candidateCacheNScans_ || candidateCacheMode_ != currentObservingMode_ ||
+         candidateCache_.size() != nsrc ) {
+        candidateCacheValid_ = false;
     }
-    return subcon;
+    if ( candidateCacheValid_ ) {
+        for ( unsigned long i = candidateCacheNScans_; i < scans_.size(); ++i ) {
+            const Scan &scan = scans_[i];
+            touchedSources[scan.getSourceId()] = true;
+            for ( unsigned long j = 0; j < scan.getNSta(); ++j ) {
+                touchedStations[scan.getStationId( j )] = true;
+            }
+        }
+    }
+
+    // split visible scans into reusable and new candidates
+    vector<Scan> visibleScans = subcon.takeSingleSourceScans();
+    vector<CandidateCacheEntry> newCache( nsrc );
+    unsigned long nReused = 0;
+    for ( auto &scan : visibleScans ) {
+        unsigned long srcid = scan.getSourceId();
+        vector<unsigned long> staids = scan.getStationIds();
+
+        bool reuse = false;
+        if ( candidateCacheValid_ ) {
+            const CandidateCacheEntry &entry = candidateCache_[srcid];
+            reuse = entry.cached && !touchedSources[srcid] && entry.staids == staids &&
+                    none_of( staids.begin(), staids.end(),
+                             [&touchedStations]( unsigned long staid ) { return touchedStations[staid]; } );
+        }
+        if ( reuse ) {
+            newCache[srcid] = move( candidateCache_[srcid] );
+            ++nReused;
+        } else {
+            newCache[srcid].staids = move( staids );
+            subcon.addScan( move( scan ) );
+        }
+    }
+    visibleScans.clear();
+
+#ifdef VIESCHEDPP_LOG
+    if ( Flags::logDebug )
+        BOOST_LOG_TRIVIAL( debug ) << "subcon " << subcon.printId() << " reuse " << nReused
+                                   << " processed candidates of previous scan selection";
+#endif
+
+    // process new candidates
+    processVisibleScans( subcon, endposition );
+    for ( auto &scan : subcon.takeSingleSourceScans() ) {
+        // copy (instead of move) because the cache outlives the scan selection arena
+        newCache[scan.getSourceId()].scan = scan;
+    }
+
+    // merge candidates (ordered by source id, same as visible scans)
+    for ( unsigned long srcid = 0; srcid < nsrc; ++srcid ) {
+        CandidateCacheEntry &entry = newCache[srcid];
+        if ( entry.staids.empty() ) {
+            continue;
+        }
+        entry.cached = true;
+        if ( entry.scan.is_initialized() ) {
+            subcon.addScan( Scan( *entry.scan ) );
+        }
+    }
+
+    candidateCache_ = move( newCache );
+    candidateCacheNScans_ = scans_.size();
+    candidateCacheMode_ = currentObservingMode_;
+    candidateCacheValid_ = true;
 }
 
 
@@ -674,10 +797,8 @@ Subcon Scheduler::allVisibleScans( Scan::ScanType type, const boost::optional<St
     if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "creating new subcon " << subcon.printId();
 #endif
 
-    for ( const auto &thisSource : sourceList_.getSources() ) {
-        subcon.visibleScan( currentTime, type, network_, thisSource, observedSources,
-                            doNotObserveSourcesWithinMinRepeat );
-    }
+    subcon.visibleScans( currentTime, type, network_, sourceList_, observedSources,
+                         doNotObserveSourcesWithinMinRepeat );
 
     return subcon;
 }
@@ -725,7 +846,8 @@ void Scheduler::update( Scan &scan, ofstream &of ) noexcept {
     }
 
     scan.output( scans_.size(), network_, thisSource, of );
-    scans_.push_back( std::move( scan ) );
+    // copy (instead of move) because candidate scans are allocated from the scan selection arena
+    scans_.push_back( scan );
 }
 
 
@@ -1031,6 +1153,7 @@ bool Scheduler::checkForNewEvents( unsigned int time, bool output, ofstream &of,
 #endif
                 auto &skyCoverage = network_.refSkyCoverage( network_.getStaid2skyCoverageId().at( any.getId() ) );
                 startTagelongMode( any, skyCoverage, of );
+                candidateCacheValid_ = false;
             }
         }
     }
@@ -1048,6 +1171,7 @@ bool Scheduler::checkForNewEvents( unsigned int time, bool output, ofstream &of,
 #endif
                 auto &skyCoverage = network_.refSkyCoverage( network_.getStaid2skyCoverageId().at( any.getId() ) );
                 startThinMode( any, skyCoverage, start, end, nscans, of );
+                candidateCacheValid_ = false;
             }
         }
     }
@@ -1100,6 +1224,11 @@ bool Scheduler::checkForNewEvents( unsigned int time, bool output, ofstream &of,
         util::outputObjectList( "baseline parameter changed", baselineChanged, of );
         of << boost::format( "|%|143T-||\n" );
     }
+
+    // processed candidates depend on station, source and baseline parameters
+    if ( !stationChanged.empty() || !sourcesChanged.empty() || !baselineChanged.empty() ) {
+        candidateCacheValid_ = false;
+    }
     return hard_break;
 }
 
@@ -2215,10 +2344,11 @@ void Scheduler::calibratorBlocks( std::ofstream &of ) {
     }
 
     for ( auto block : calib_ ) {
-        std::fill( CalibratorBlock::stationFlag.begin(), CalibratorBlock::stationFlag.end(), 0 );
+        auto &stationFlag = CalibratorBlock::stationFlag.edit();
+        std::fill( stationFlag.begin(), stationFlag.end(), 0 );
         for ( const auto &sta : network_.getStations() ) {
             if ( !sta.getPARA().available ) {
-                CalibratorBlock::stationFlag[sta.getId()] = -1;
+                stationFlag[sta.getId()] = -1;
             }
         }
         of << boost::format( "|%|143t||\n" );
@@ -2387,7 +2517,7 @@ void Scheduler::calibratorBlocks( std::ofstream &of ) {
                         unsigned long staid = scan.getStationId( i );
                         unsigned int obsDur = scan.getTimes().getObservingDuration( i );
                         network_.refStation( staid ).addObservingTime( obsDur );
-                        ++CalibratorBlock::stationFlag[staid];
+                        ++CalibratorBlock::stationFlag.edit()[staid];
                     }
                 }
 
@@ -3584,6 +3714,27 @@ void Scheduler::updateObservingTimes() {
 }
 
 
+bool Scheduler::reportCheckpoint( unsigned int time ) {
+    Checkpoint checkpoint;
+    checkpoint.version = version_;
+    checkpoint.time = time;
+    checkpoint.nScans = scans_.size();
+    checkpoint.nScansPerSource.resize( sourceList_.getNSrc(), 0 );
+    for ( const auto &scan : scans_ ) {
+        checkpoint.nObservations += scan.getNObs();
+        ++checkpoint.nScansPerSource[scan.getSourceId()];
+    }
+    const auto &skyCoverages = network_.getSkyCoverages();
+    for ( const auto &sky : skyCoverages ) {
+        checkpoint.skyCoverage += sky.partialSkyCoverageScore( time );
+    }
+    if ( !skyCoverages.empty() ) {
+        checkpoint.skyCoverage /= skyCoverages.size();
+    }
+    return checkpointCallback_( checkpoint );
+}
+
+
 int Scheduler::getNumberOfObservations() const noexcept {
     int n = 0;
     for ( const auto &any : scans_ ) {
@@ -30,6 +30,7 @@
 
 #include <boost/date_time.hpp>
 #include <boost/optional.hpp>
+#include <functional>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -37,6 +38,7 @@
 #include "Algorithm/FocusCorners.h"
 #include "Initializer.h"
 #include "Misc/Constants.h"
+#include "Misc/SchedulingContext.h"
 #include "Misc/StationEndposition.h"
 #include "Misc/Subnetting.h"
 #include "Scan/Subcon.h"
@@ -89,6 +91,8 @@ class Scheduler : public VieVS_NamedObject {
             true;  ///< consider scans (with reduced weight) if they are within min repeat time
 
         bool writeSkyCoverageData = false;  ///< flag if sky coverage data should be printed to file
+
+        bool incrementalSubcon = true;  ///< reuse unaffected candidates of previous scan selection
     };
 
     /**
@@ -100,6 +104,20 @@ class Scheduler : public VieVS_NamedObject {
     };
 
 
+    /**
+     * @brief partial statistics of a schedule reported during scan selection
+     * @author Matthias Schartner
+     */
+    struct Checkpoint {
+        int version = 0;                            ///< version number
+        unsigned int time = 0;                      ///< checkpoint time in seconds since session start
+        unsigned long nScans = 0;                   ///< number of scans so far
+        unsigned long nObservations = 0;            ///< number of observations so far
+        double skyCoverage = 0;                     ///< average sky coverage score so far
+        std::vector<unsigned int> nScansPerSource;  ///< number of scans per source so far
+    };
+
+
     /**
      * @brief constructor
      * @author Matthias Schartner
@@ -286,6 +304,43 @@ class Scheduler : public VieVS_NamedObject {
     const std::vector<Scan> &getScans() const noexcept { return scans_; }
 
 
+    /**
+     * @brief get session parameters of this schedule
+     * @author Matthias Schartner
+     *
+     * apply it before this schedule is processed on another thread
+     *
+     * @return scheduling context
+     */
+    const SchedulingContext &getSchedulingContext() const noexcept { return context_; }
+
+
+    /**
+     * @brief report partial statistics during scan selection
+     * @author Matthias Schartner
+     *
+     * The callback is called each time the scan selection passes a multiple of the interval. If it returns false the
+     * scheduling is aborted (see isAborted()). Checkpoints are only reported if the whole session is scheduled in
+     * one pass (no fixed high impact, calibrator or a priori scans).
+     *
+     * @param interval checkpoint interval in seconds
+     * @param callback function which is called at each checkpoint, return false to abort
+     */
+    void setCheckpointCallback( unsigned int interval, std::function<bool( const Checkpoint & )> callback ) {
+        checkpointInterval_ = interval;
+        checkpointCallback_ = std::move( callback );
+    }
+
+
+    /**
+     * @brief check if scheduling was aborted at a checkpoint
+     * @author Matthias Schartner
+     *
+     * @return true if aborted
+     */
+    bool isAborted() const noexcept { return aborted_; }
+
+
     /**
      * @brief check if there is a satellite too close to a scan
      * @author Matthias Schartner
@@ -315,6 +370,61 @@ class Scheduler : public VieVS_NamedObject {
     boost::optional<HighImpactScanDescriptor> himp_;                          ///< high impact scan descriptor
     std::vector<CalibratorBlock> calib_;                                      ///< fringeFinder impact scan descriptor
     boost::optional<MultiScheduling::Parameters> multiSchedulingParameters_;  ///< multi scheduling paramters
+    SchedulingContext context_;  ///< session parameters of thread which created this schedule
+
+    /**
+     * @brief processed candidate of one source from the previous scan selection
+     * @author Matthias Schartner
+     */
+    struct CandidateCacheEntry {
+        bool cached = false;                ///< flag if entry is set
+        std::vector<unsigned long> staids;  ///< station ids of visible scan before processing
+        boost::optional<Scan> scan;         ///< processed scan (not set if scan became invalid)
+    };
+
+    bool candidateCacheValid_ = false;                 ///< flag if candidate cache can be used
+    unsigned long candidateCacheNScans_ = 0;           ///< number of scans when candidate cache was created
+    std::shared_ptr<const Mode> candidateCacheMode_;   ///< observing mode when candidate cache was created
+    std::vector<CandidateCacheEntry> candidateCache_;  ///< candidate cache per source
+
+    unsigned int checkpointInterval_ = 0;                                     ///< checkpoint interval in seconds
+    unsigned int nextCheckpoint_ = std::numeric_limits<unsigned int>::max();  ///< time of next checkpoint
+    std::function<bool( const Checkpoint & )> checkpointCallback_;            ///< checkpoint callback
+    bool aborted_ = false;                                                    ///< aborted at checkpoint
+
+
+    /**
+     * @brief create partial statistics and call checkpoint callback
+     * @author Matthias Schartner
+     *
+     * @param time checkpoint time
+     * @return false if scheduling should be aborted
+     */
+    bool reportCheckpoint( unsigned int time );
+
+
+    /**
+     * @brief process visible scans incrementally
+     * @author Matthias Schartner
+     *
+     * Processed candidates of the previous scan selection are reused if their source was not observed, none of
+     * their stations was part of a scan since then and the visible scan consists of the same stations. All other
+     * candidates are processed. The result is identical to processing all visible scans.
+     *
+     * @param subcon subcon with all visible single source scans
+     * @param endposition required endposition
+     */
+    void processIncremental( Subcon &subcon, const boost::optional<StationEndposition> &endposition ) noexcept;
+
+
+    /**
+     * @brief calculate start times, azimuth, elevation and durations of all visible scans
+     * @author Matthias Schartner
+     *
+     * @param subcon subcon with all visible single source scans
+     * @param endposition required endposition
+     */
+    void processVisibleScans( Subcon &subcon, const boost::optional<StationEndposition> &endposition ) noexcept;
 
 
     /**
@@ -41,6 +41,7 @@ Simulator::Simulator(Output &output)
           path_{std::move(output.path_)},
           version_{output.version_},
           multiSchedulingParameters_{ std::move( output.multiSchedulingParameters_ ) },
+          context_{ SchedulingContext::capture() },
           simpara_{ vector<SimPara>( network_.getNSta() ) } {
     auto tmp = xml_.get_optional<int>( "VieSchedpp.simulator.seed" );
     if ( tmp.is_initialized() ) {
@@ -49,8 +50,6 @@ Simulator::Simulator(Output &output)
         seed_ = std::chrono::system_clock::now().time_since_epoch().count();
     }
 
-    generator_ = default_random_engine( seed_ );
-
     string file = path_;
     file.append( getName() ).append( "_simulator.txt" );
     of = ofstream( file );
@@ -100,136 +99,126 @@ void Simulator::start() {
 void Simulator::simClock() {
     unsigned long nsta = network_.getNSta();
 
-    // loop over all stations
+    clk_.resize( nsta );
+    vector<string> log( nsta );
+
+    // loop over all stations (in parallel - every station uses its own random number streams)
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) if ( runParallel( nsta ) )
+#endif
     for ( int ista = 0; ista < nsta; ++ista ) {
+        SchedulingContext::Scope scope( context_ );
         auto start = std::chrono::high_resolution_clock::now();
         const auto &simpara = simpara_[ista];
         if ( simpara.clockASD < 1e-20 ) {
-            clk_.emplace_back( MatrixXd::Zero( scans_.size(), nsim ) );
+            clk_[ista] = MatrixXd::Zero( scans_.size(), nsim );
             continue;
         }
-        of << boost::format( "    %-8s " ) % network_.getStation( ista ).getName();
-
-        unsigned int refTime = 0;
-        VectorXd rw = VectorXd::Zero( nsim );
-        VectorXd irw = VectorXd::Zero( nsim );
 
         double phic_rw = simpara.clockASD * simpara.clockASD * simpara.clockDur * 60;
         double phic_irw = simpara.clockASD * simpara.clockASD / ( simpara.clockDur * 60 ) * 3;
-        normal_distribution<double> wn_rw = normal_distribution<double>( 0.0, sqrt( phic_rw ) );
-        auto wn_rw_f = [this, &wn_rw]() { return wn_rw( generator_ ); };
-        normal_distribution<double> wn_irw = normal_distribution<double>( 0.0, sqrt( phic_irw ) );
-        auto wn_irw_f = [this, &wn_irw]() { return wn_irw( generator_ ); };
-        VectorXd v = VectorXd::Zero( nsim, 1 );
 
-        Eigen::MatrixXd clk( nsim, scans_.size() );
-
-        // loop over all scans
-        for ( int iscan = 0; iscan < scans_.size(); ++iscan ) {
-            const auto &scan = scans_[iscan];
-            unsigned int startTime = scan.getTimes().getObservingTime();
-            auto dt = static_cast<double>( startTime - refTime );
+        Eigen::MatrixXd clk( scans_.size(), nsim );
+
+        // loop over all simulation runs (each with its own random number stream)
+        for ( int isim = 0; isim < nsim; ++isim ) {
+            mt19937_64 generator = randomStream( RandomStream::clock, ista, isim );
+            normal_distribution<double> wn_rw = normal_distribution<double>( 0.0, sqrt( phic_rw ) );
+            normal_distribution<double> wn_irw = normal_distribution<double>( 0.0, sqrt( phic_irw ) );
+
+            unsigned int refTime = 0;
+            double rw = 0;
+            double irw = 0;
+            double v = 0;
+
+            // loop over all scans
+            for ( int iscan = 0; iscan < scans_.size(); ++iscan ) {
+                const auto &scan = scans_[iscan];
+                unsigned int startTime = scan.getTimes().getObservingTime();
+                auto dt = static_cast<double>( startTime - refTime );
+
+                // for the first scan, set noise to zero
+                if ( iscan == 0 ) {
+                    clk( iscan, isim ) = 0;
+                    continue;
+                }
 
-            // for the first scan, set noise to zero
-            if ( iscan == 0 ) {
-                clk.col( iscan ).array() = 0;
-                continue;
-            }
+                if ( dt != 0 ) {
+                    rw += wn_rw( generator ) * sqrt( dt );
 
-            if ( dt != 0 ) {
-                rw += VectorXd::NullaryExpr( nsim, wn_rw_f ) * sqrt( dt );
+                    double tmp = wn_irw( generator ) * sqrt( dt );
+                    irw += v * dt + tmp / 2 * dt;
+                    v += tmp;
+                }
+                clk( iscan, isim ) = rw + irw;
 
-                VectorXd tmp = VectorXd::NullaryExpr( nsim, wn_irw_f ) * sqrt( dt );
-                irw += v * dt + tmp / 2 * dt;
-                v += tmp;
+                refTime = startTime;
             }
-            clk.col( iscan ) = rw + irw;
-
-            refTime = startTime;
         }
-        clk_.emplace_back( clk.transpose() );
+        clk_[ista] = move( clk );
         auto finish = std::chrono::high_resolution_clock::now();
         auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>( finish - start );
         long long int usec = microseconds.count();
-        of << "(" << util::milliseconds2string( usec, true ) << ")" << endl;
+        log[ista] = ( boost::format( "    %-8s (%s)\n" ) % network_.getStation( ista ).getName() %
+                      util::milliseconds2string( usec, true ) )
+                        .str();
+    }
+
+    for ( const auto &any : log ) {
+        of << any;
     }
 }
 
 void Simulator::simTropo() {
     const unsigned long nsta = network_.getNSta();
-    const double L23 = pow( 3e6, 2.0 / 3.0 );
-    normal_distribution<double> normalDistribution = normal_distribution<double>( 0.0, 1.0 );
-
-    auto normalDist = [this, &normalDistribution]() { return normalDistribution( generator_ ); };
 
+    tropo_.resize( nsta );
+    vector<string> log( nsta );
 
-    // loop over all stations
+    // loop over all stations (in parallel - every station uses its own random number streams)
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) if ( runParallel( nsta ) )
+#endif
     for ( int staid = 0; staid < nsta; ++staid ) {
+        SchedulingContext::Scope scope( context_ );
         auto start = std::chrono::high_resolution_clock::now();
         const auto &simpara = simpara_[staid];
 
         int segments = ceil( TimeSystem::duration / ( simpara.tropo_dhseg * 3600 ) );
-        if ( segments == 1 ) {
+        if ( segments < 2 ) {
             segments = 2;
         }
         VectorXd tn = VectorXd::Zero( segments );
         vector<PointingVector> pvs;
 
-        unsigned int c = 0;
         for ( const auto &any : scans_ ) {
             if ( any.findIdxOfStationId( staid ).is_initialized() ) {
                 PointingVector pv = any.getPointingVector( *any.findIdxOfStationId( staid ) );
                 ++tn( pv.getTime() / ( simpara.tropo_dhseg * 3600 ) );
                 pvs.push_back( pv );
-                ++c;
-            }
-        }
-
-        VectorXd mfw = VectorXd::Zero( c );
-        c = 0;
-        for ( const auto &any : scans_ ) {
-            if ( any.findIdxOfStationId( staid ).is_initialized() ) {
-                PointingVector pv = any.getPointingVector( *any.findIdxOfStationId( staid ) );
-                mfw( c ) = 1 / sin( pv.getEl() );
-                ++c;
             }
         }
+        const unsigned long nobs = pvs.size();
 
         if ( simpara.tropo_Cn < 1e-20 ) {
-            tropo_.emplace_back( MatrixXd::Zero( pvs.size(), nsim ) );
+            tropo_[staid] = MatrixXd::Zero( nobs, nsim );
             continue;
         }
-        of << boost::format( "    %-8s " ) % network_.getStation( staid ).getName();
-        const double Cn = simpara.tropo_Cn;
-        const Eigen::Vector3d v( simpara.tropo_vn * 3600, simpara.tropo_ve * 3600, 0 );
-        const double Cnall = Cn * Cn / 2 * 1e6 * simpara.tropo_dh * simpara.tropo_dh;
-
-        const int nh = floor( simpara.tropo_H / simpara.tropo_dh );
-        VectorXd rho4x = VectorXd( ( nh + 1 ) * ( nh + 1 ) );
-        VectorXd z = VectorXd( ( nh + 1 ) * ( nh + 1 ) );
-        VectorXd zs = VectorXd( ( nh + 1 ) * ( nh + 1 ) );
-        c = 0;
-        for ( int i = 0; i < nh + 1; ++i ) {
-            double zs_s = simpara.tropo_dh * i;
-            for ( int j = 0; j < nh + 1; ++j ) {
-                double z_s = simpara.tropo_dh * j;
-                double rho4 = abs( z_s - zs_s );
-                double tmp = cbrt( rho4 );
-                tmp = tmp * tmp;
-                double rho4x_s = tmp / ( 1 + tmp / L23 );
-
-                rho4x( c ) = rho4x_s;
-                z( c ) = z_s;
-                zs( c ) = zs_s;
-                ++c;
-            }
-        }
 
-
-        auto calcR = []( const PointingVector &pv ) {
-            Vector3d r( cos( pv.getAz() ) / tan( pv.getEl() ), sin( pv.getAz() ) / tan( pv.getEl() ), 1 );
-            return r;
-        };
+        // ray geometry of all observations
+        VectorXd mfw( nobs );
+        vector<double> az( nobs );
+        vector<double> el( nobs );
+        vector<double> time( nobs );
+        for ( unsigned long i = 0; i < nobs; ++i ) {
+            const PointingVector &pv = pvs[i];
+            mfw( i ) = 1 / sin( pv.getEl() );
+            az[i] = pv.getAz();
+            el[i] = pv.getEl();
+            time[i] = pv.getTime();
+        }
+        TurbulenceCovariance covariance( az, el, time, simpara.tropo_Cn, simpara.tropo_H, simpara.tropo_dh,
+                                         simpara.tropo_vn, simpara.tropo_ve );
 
         vector<MatrixXd> Ds;
         MatrixXd C11 = MatrixXd::Zero( 0, 0 );
@@ -249,55 +238,26 @@ void Simulator::simTropo() {
             C.topLeftCorner( num1, num1 ) = C11;
 
             for ( int i = 0; i < num3; ++i ) {
-                const PointingVector &pv1 = pvs[k + i];
-                double t1_h = pv1.getTime() / 3600.;
-
-                Vector3d r1 = calcR( pv1 );
-                MatrixXd rz1 = r1 * z.transpose();
-
-                MatrixXd dd1 = rz1;
-                dd1.row( 2 ) -= zs;
-                dd1 = dd1.colwise() + v * t1_h;
-
-                VectorXd rho1 =
-                    ( dd1.array() * dd1.array() ).colwise().sum().unaryExpr( []( double d ) { return cbrt( d ); } );
-                VectorXd rho1x = rho1.array() / ( 1 + rho1.array() / L23 );
-
                 for ( int j = max( i, num1 ); j < num3; ++j ) {
-                    const PointingVector &pv2 = pvs[k + j];
-
-                    double t2_h = pv2.getTime() / 3600.;
-                    Vector3d r2 = calcR( pv2 );
-                    MatrixXd rz2 = r2 * z.transpose();
-
-                    MatrixXd dd2 = rz2;
-                    dd2.row( 2 ) -= zs;
-                    dd2 = dd2.colwise() + v * t2_h;
-
-                    VectorXd rho2 =
-                        ( dd2.array() * dd2.array() ).colwise().sum().unaryExpr( []( double d ) { return cbrt( d ); } );
-
-                    double dt12_h = t2_h - t1_h;
-                    MatrixXd rzs2 = r2 * zs.transpose();
-
-                    MatrixXd dd3 = rz1 - rzs2;
-                    dd3 = dd3.colwise() - v * dt12_h;
-                    VectorXd rho3 =
-                        ( dd3.array() * dd3.array() ).colwise().sum().unaryExpr( []( double d ) { return cbrt( d ); } );
-
-                    double result = ( rho1x.array() + rho2.array() / ( 1 + rho2.array() / L23 ) -
-                                      rho3.array() / ( 1 + rho3.array() / L23 ) - rho4x.array() )
-                                        .sum();
-                    C( j, i ) = Cnall * result;
+                    C( j, i ) = covariance( k + i, k + j );
                 }
             }
             Ds.emplace_back( C.llt().matrixL() );
-            // cout << Ds.back() << endl << endl;
             C11 = C.bottomRightCorner( tn( i2 ), tn( i2 ) );
         }
 
 
-        MatrixXd l = MatrixXd::Zero( pvs.size(), nsim );
+        // standard normal distributed random numbers (each simulation run with its own random number stream)
+        MatrixXd randn( nobs, nsim );
+        for ( int isim = 0; isim < nsim; ++isim ) {
+            mt19937_64 generator = randomStream( RandomStream::tropo, staid, isim );
+            normal_distribution<double> normalDistribution = normal_distribution<double>( 0.0, 1.0 );
+            for ( unsigned long i = 0; i < nobs; ++i ) {
+                randn( i, isim ) = normalDistribution( generator );
+            }
+        }
+
+        MatrixXd l = MatrixXd::Zero( nobs, nsim );
         MatrixXd l1;
         for ( int i1 = 0; i1 < segments - 1; ++i1 ) {
             int i2 = i1 + 1;
@@ -312,12 +272,9 @@ void Simulator::simTropo() {
 
             const MatrixXd &D = Ds[i1];
             MatrixXd D11 = D.topLeftCorner( num1, num1 );
-            //            cout << "D11" << endl << D11 << endl << endl;
             MatrixXd D21 = D.bottomLeftCorner( num2, num1 );
-            //            cout << "D21" << endl << D21 << endl << endl;
             MatrixXd D22 = D.bottomRightCorner( num2, num2 );
-            //            cout << "D22" << endl << D22 << endl << endl;
-            MatrixXd x = MatrixXd::NullaryExpr( num2, nsim, normalDist );
+            const auto &x = randn.block( k, 0, num2, nsim );
 
             if ( i1 == 0 ) {
                 MatrixXd tmp = D22 * x;
@@ -328,11 +285,17 @@ void Simulator::simTropo() {
                 l.block( k, 0, num2, nsim ) = l1;
             }
         }
-        tropo_.emplace_back( ( l.array() + simpara.tropo_wzd0 ).array().colwise() * mfw.array() * 1e-3 / speedOfLight );
+        tropo_[staid] = ( l.array() + simpara.tropo_wzd0 ).array().colwise() * mfw.array() * 1e-3 / speedOfLight;
         auto finish = std::chrono::high_resolution_clock::now();
         auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>( finish - start );
         long long int usec = microseconds.count();
-        of << "(" << util::milliseconds2string( usec, true ) << ")" << endl;
+        log[staid] = ( boost::format( "    %-8s (%s)\n" ) % network_.getStation( staid ).getName() %
+                       util::milliseconds2string( usec, true ) )
+                         .str();
+    }
+
+    for ( const auto &any : log ) {
+        of << any;
     }
 }
 
@@ -344,57 +307,27 @@ void Simulator::calcO_C() {
         }
     }
 
-    obs_minus_com_ = Eigen::MatrixXd( nobs, nsim );
     P_ = Eigen::VectorXd( nobs );
-
     double constexpr constNoise = ( 0.005 / speedOfLight ) * ( 0.005 / speedOfLight );
-    unsigned int iobs = 0;
     vector<int> tropoCounter( network_.getNSta(), -1 );
+    tropoRow_ = vector<vector<int>>( scans_.size(), vector<int>( network_.getNSta(), -1 ) );
+    vector<int> firstRow( scans_.size() );
 
+    int iobs = 0;
     for ( int iscan = 0; iscan < scans_.size(); ++iscan ) {
         const Scan &scan = scans_[iscan];
 
         for ( int ista = 0; ista < network_.getNSta(); ++ista ) {
             if ( scan.findIdxOfStationId( ista ).is_initialized() ) {
                 ++tropoCounter[ista];
+                tropoRow_[iscan][ista] = tropoCounter[ista];
             }
         }
 
+        firstRow[iscan] = iobs;
         for ( const Observation &obs : scan.getObservations() ) {
-            unsigned long staid1 = obs.getStaid1();
-            unsigned long staid2 = obs.getStaid2();
-            unsigned long tropoId_staid1 = tropoCounter[staid1];
-            unsigned long tropoId_staid2 = tropoCounter[staid2];
-            const auto &p1 = simpara_[staid1];
-            const auto &p2 = simpara_[staid2];
-
-
-            VectorXd wn1;
-            VectorXd wn2;
-            if ( simWn_ ) {
-                if ( simpara_[staid1].wn > 1e-10 ) {
-                    auto dist1 = normal_distribution<double>( 0.0, simpara_[staid1].wn * 1e-12 );
-                    auto normalDist1 = [this, &dist1]() { return dist1( generator_ ); };
-                    wn1 = VectorXd::NullaryExpr( nsim, normalDist1 );
-                } else {
-                    wn1 = VectorXd::Zero( nsim );
-                }
-
-                if ( simpara_[staid2].wn > 1e-10 ) {
-                    auto dist2 = normal_distribution<double>( 0.0, simpara_[staid2].wn * 1e-12 );
-                    auto normalDist2 = [this, &dist2]() { return dist2( generator_ ); };
-                    wn2 = VectorXd::NullaryExpr( nsim, normalDist2 );
-                } else {
-                    wn2 = VectorXd::Zero( nsim );
-                }
-            } else {
-                wn1 = VectorXd::Zero( nsim );
-                wn2 = VectorXd::Zero( nsim );
-            }
-
-            obs_minus_com_.row( iobs ) = wn2.transpose() - wn1.transpose() + clk_[staid2].row( iscan ) -
-                                         clk_[staid1].row( iscan ) + tropo_[staid2].row( tropoId_staid2 ) -
-                                         tropo_[staid1].row( tropoId_staid1 );
+            const auto &p1 = simpara_[obs.getStaid1()];
+            const auto &p2 = simpara_[obs.getStaid2()];
 
             double varNoise = ( p1.wn * p1.wn + p2.wn * p2.wn ) * 1e-24;
             double sigma = 1 / ( ( constNoise + varNoise ) * speedOfLight * speedOfLight * 100 * 100 );
@@ -403,12 +336,29 @@ void Simulator::calcO_C() {
         }
     }
 
+    // in streaming mode the solver requests o-c scan by scan
+    if ( !xml_.get( "VieSchedpp.solver.streaming", false ) ) {
+        obs_minus_com_ = Eigen::MatrixXd( nobs, nsim );
+        const long nscans = static_cast<long>( scans_.size() );
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic ) if ( runParallel( nscans ) )
+#endif
+        for ( long iscan = 0; iscan < nscans; ++iscan ) {
+            SchedulingContext::Scope scope( context_ );
+            const Scan &scan = scans_[iscan];
+            obs_minus_com_.middleRows( firstRow[iscan], scan.getNObs() ) = obsMinusCom( iscan, scan );
+        }
+    }
+
     if (xml_.get("VieSchedpp.simulator.output.obs_minus_comp", false)){
         string file = path_;
         file.append( getName() ).append( "_obs-comp.csv" );
         ofstream of_tmp( file );
-        int c = 0;
-        for (const auto & scan : scans_) {
+        for ( unsigned long iscan = 0; iscan < scans_.size(); ++iscan ) {
+            const auto &scan = scans_[iscan];
+            MatrixXd o_c = obs_minus_com_.size() > 0 ? obs_minus_com_.middleRows( firstRow[iscan], scan.getNObs() )
+                                                     : obsMinusCom( iscan, scan );
+            int c = 0;
             for ( const Observation &obs : scan.getObservations() ) {
                 unsigned long staid1 = obs.getStaid1();
                 const string &sta1 = network_.getStation(staid1).getName();
@@ -420,12 +370,43 @@ void Simulator::calcO_C() {
                 string t = TimeSystem::time2string(time);
 
                 of_tmp << boost::format("%s,%s,%s,%s,") % sta1 % sta2 % src % t;
-                of_tmp << obs_minus_com_.row( c ).format(IOFormat(StreamPrecision, DontAlignCols, ",", "\n")) << "\n";
+                of_tmp << o_c.row( c ).format(IOFormat(StreamPrecision, DontAlignCols, ",", "\n")) << "\n";
                 ++c;
             }
         }
     }
 }
+
+MatrixXd Simulator::obsMinusCom( unsigned long iscan, const Scan &scan ) const {
+    const auto &observations = scan.getObservations();
+    MatrixXd o_c = MatrixXd::Zero( observations.size(), nsim );
+
+    // white noise (one random number stream per scan)
+    if ( simWn_ ) {
+        mt19937_64 generator = randomStream( RandomStream::whiteNoise, iscan, 0 );
+        normal_distribution<double> normalDistribution = normal_distribution<double>( 0.0, 1.0 );
+        for ( int isim = 0; isim < nsim; ++isim ) {
+            for ( unsigned long i = 0; i < observations.size(); ++i ) {
+                const auto &p1 = simpara_[observations[i].getStaid1()];
+                const auto &p2 = simpara_[observations[i].getStaid2()];
+                double wn1 = p1.wn > 1e-10 ? normalDistribution( generator ) * p1.wn * 1e-12 : 0;
+                double wn2 = p2.wn > 1e-10 ? normalDistribution( generator ) * p2.wn * 1e-12 : 0;
+                o_c( i, isim ) = wn2 - wn1;
+            }
+        }
+    }
+
+    // clock and troposphere
+    const vector<int> &tropoRow = tropoRow_[iscan];
+    for ( unsigned long i = 0; i < observations.size(); ++i ) {
+        unsigned long staid1 = observations[i].getStaid1();
+        unsigned long staid2 = observations[i].getStaid2();
+        o_c.row( i ) += clk_[staid2].row( iscan ) - clk_[staid1].row( iscan ) +
+                        tropo_[staid2].row( tropoRow[staid2] ) - tropo_[staid1].row( tropoRow[staid1] );
+    }
+    return o_c;
+}
+
 void Simulator::simClockDummy() {
     unsigned long nsta = network_.getNSta();
     for ( int ista = 0; ista < nsta; ++ista ) {
@@ -450,6 +431,7 @@ void Simulator::setup() {
     unsigned long nsta = network_.getNSta();
     const boost::property_tree::ptree &tree = xml_.get_child( "VieSchedpp.simulator" );
     nsim = tree.get( "number_of_simulations", 1000 );
+    multithreading_ = tree.get( "multithreading", true );
     vector<SimPara> simparas;
     vector<string> names;
     bool all = false;
@@ -32,8 +32,14 @@
 // clang-format off
 #include "../Eigen/Dense"
 // clang-format on
+#include "../Misc/SchedulingContext.h"
 #include "../Misc/VieVS_NamedObject.h"
 #include "../Output/Output.h"
+#include "TurbulenceCovariance.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace VieVS {
 
@@ -95,10 +101,12 @@ class Simulator : public VieVS_NamedObject {
     const std::vector<Scan> scans_;                                           ///< all scans in schedule
     const std::shared_ptr<const ObservingMode> &obsModes_;                    ///< observing mode
     boost::optional<MultiScheduling::Parameters> multiSchedulingParameters_;  ///< multi scheduling parameters
+    const SchedulingContext context_;  ///< session parameters (applied on worker threads of parallel loops)
 
     std::vector<Eigen::MatrixXd> clk_;
     std::vector<Eigen::MatrixXd> tropo_;
-    Eigen::MatrixXd obs_minus_com_;
+    std::vector<std::vector<int>> tropoRow_;  ///< troposphere row per scan and station (-1 if not in scan)
+    Eigen::MatrixXd obs_minus_com_;           ///< observed minus computed (empty if solver runs in streaming mode)
     Eigen::VectorXd P_;
     bool simTropo_ = true;
     bool simClock_ = true;
@@ -106,7 +114,54 @@ class Simulator : public VieVS_NamedObject {
 
     std::vector<SimPara> simpara_;
     int nsim = 1;
-    std::default_random_engine generator_;
+    bool multithreading_ = true;  ///< simulate stations and simulation runs in parallel
+
+    /**
+     * @brief check if work should be distributed to multiple threads
+     * @author Matthias Schartner
+     *
+     * only if multithreading is enabled and the simulator is not already executed within a parallel region (e.g.
+     * multi scheduling). Session parameters (e.g. TimeSystem) are thread local, every iteration of a parallel loop
+     * applies context_ first.
+     *
+     * @param nTasks number of independent tasks
+     * @return flag if work is done in parallel
+     */
+    bool runParallel( long nTasks ) const {
+#ifdef _OPENMP
+        return multithreading_ && nTasks > 1 && omp_get_max_threads() > 1 && !omp_in_parallel();
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief simulated error component
+     * @author Matthias Schartner
+     */
+    enum class RandomStream {
+        clock = 0,       ///< clock
+        tropo = 1,       ///< troposphere
+        whiteNoise = 2,  ///< white noise
+    };
+
+    /**
+     * @brief independent random number stream
+     * @author Matthias Schartner
+     *
+     * every version, error component, station and simulation run uses its own stream, results therefore do not
+     * depend on the order in which stations and simulation runs are processed
+     *
+     * @param component error component
+     * @param key station id (scan index for white noise)
+     * @param isim simulation run
+     * @return random number generator engine
+     */
+    std::mt19937_64 randomStream( RandomStream component, unsigned long key, int isim ) const {
+        return std::mt19937_64( util::streamSeed( seed_, { static_cast<std::uint64_t>( version_ ),
+                                                           static_cast<std::uint64_t>( component ), key,
+                                                           static_cast<std::uint64_t>( isim ) } ) );
+    }
 
     void simClock();
     void simClockDummy();
@@ -116,6 +171,20 @@ class Simulator : public VieVS_NamedObject {
 
     void calcO_C();
 
+    /**
+     * @brief simulated observed minus computed of one scan
+     * @author Matthias Schartner
+     *
+     * clock and troposphere are taken from the station realisations, white noise is drawn from a random number stream
+     * of this scan. The result is therefore identical whenever it is requested (e.g. by the solver in streaming mode,
+     * where the full o-c matrix is never stored).
+     *
+     * @param iscan scan index
+     * @param scan scan (passed explicitly, scans might be moved to solver)
+     * @return observed minus computed in seconds (one row per observation, one column per simulation run)
+     */
+    Eigen::MatrixXd obsMinusCom( unsigned long iscan, const Scan &scan ) const;
+
     void setup();
 
     void parameterSummary();
@@ -36,6 +36,8 @@ Solver::Solver(Simulator &simulator)
         : VieVS_NamedObject(simulator.getName(), nextId++),
           path_{std::move(simulator.path_)},
           xml_{std::move(simulator.xml_)},
+      simulator_{ simulator },
+      context_{ SchedulingContext::capture() },
       network_{ std::move( simulator.network_ ) },
       sourceList_{ std::move( simulator.sourceList_ ) },
       scans_{ std::move( simulator.scans_ ) },
@@ -90,7 +92,7 @@ void Solver::setup() {
     }
 
     unsigned long constraints = 0;
-    int daySecOfSessionStart = TimeSystem::startTime.time_of_day().total_seconds();
+    int daySecOfSessionStart = TimeSystem::startTime.get().time_of_day().total_seconds();
 
     auto addPWL_params = [&daySecOfSessionStart, &constraints, this]( const PWL &p, const string &name = "" ) {
         if ( p.estimate() && p.getType() != Unknown::Type::undefined ) {
@@ -248,33 +250,52 @@ void Solver::setup() {
 
     unsigned long nobs_sim = 0;
     unsigned long nobs_solve = 0;
+    unsigned long iscan = 0;
     for ( const auto &scan : scans_ ) {
         unsigned long srcid = scan.getSourceId();
         bool ignore = estimationParamSources_[srcid].forceIgnore;
+        unsigned long iobs = 0;
         for ( const auto &obs : scan.getObservations() ) {
             bool inObslist = checkAgainstObslist( obs );
             if ( inObslist && !ignore ) {
                 P_AB_[nobs_solve] = P_AB_[nobs_sim];
-                obs_minus_com_.row( nobs_solve ) = obs_minus_com_.row( nobs_sim );
+                if ( streaming_ ) {
+                    obsRow_.emplace_back( iscan, iobs );
+                } else {
+                    obs_minus_com_.row( nobs_solve ) = obs_minus_com_.row( nobs_sim );
+                }
                 ++nobs_solve;
             }
             ++nobs_sim;
+            ++iobs;
         }
+        ++iscan;
     }
     for ( unsigned long i = nobs_solve; i < nobs_sim; ++i ) {
         P_AB_[i] = 0;
     }
 
     P_AB_.conservativeResize( nobs_solve + constraints );
-    obs_minus_com_.conservativeResize( nobs_solve, nsim_ );
+    if ( !streaming_ ) {
+        obs_minus_com_.conservativeResize( nobs_solve, nsim_ );
+    }
     n_A_ = nobs_solve;
     n_B_ = constraints;
 }
 
 void Solver::buildConstraintsMatrix() {
-    of << "build constraints matrix ";
+    of << ( residualPass_ ? "residuals of constraints " : "build constraints matrix " );
     auto start = std::chrono::high_resolution_clock::now();
 
+    if ( streaming_ && !residualPass_ ) {
+        if ( sparse_ ) {
+            N_sparse_ = SparseMatrix<double>( unknowns.size(), unknowns.size() );
+        } else {
+            N_ = MatrixXd::Zero( unknowns.size(), unknowns.size() );
+        }
+        n_ = MatrixXd::Zero( unknowns.size(), nsim_ );
+    }
+
     unsigned long i = n_A_;
     auto f = [this, &i]( const PWL &pwl, const string &name = "" ) {
         if ( pwl.estimate() ) {
@@ -322,6 +343,10 @@ void Solver::buildConstraintsMatrix() {
     f( estimationParamEOP_.NUTX );
     f( estimationParamEOP_.NUTY );
 
+    if ( streaming_ ) {
+        accumulateRows( n_A_, n_B_, false );
+    }
+
     auto finish = std::chrono::high_resolution_clock::now();
     auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>( finish - start );
     long long int usec = microseconds.count();
@@ -329,7 +354,7 @@ void Solver::buildConstraintsMatrix() {
 }
 
 void Solver::buildDesignMatrix() {
-    of << "build design matrix      ";
+    of << ( residualPass_ ? "residuals of observations" : "build design matrix      " );
     auto start = std::chrono::high_resolution_clock::now();
 
     unsigned int iobs = 0;
@@ -408,6 +433,7 @@ void Solver::buildDesignMatrix() {
         Matrix3d dQdX = dPNdX * R;
         Matrix3d dQdY = dPNdY * R;
 
+        unsigned int iobs0 = iobs;
         for ( const auto &obs : scan.getObservations() ) {
             if ( !checkAgainstObslist( obs ) ) {
                 continue;
@@ -419,6 +445,9 @@ void Solver::buildDesignMatrix() {
             partialsToA( iobs, obs, pv1, pv2, p );
             ++iobs;
         }
+        if ( streaming_ && iobs > iobs0 ) {
+            accumulateRows( iobs0, iobs - iobs0, true );
+        }
     }
 
     auto finish = std::chrono::high_resolution_clock::now();
@@ -455,29 +484,75 @@ void Solver::solve() {
     of << "Number of simulation runs: " << nsim_ << "\n";
     of << "Number of observations:    " << n_A_ << " of " << nobsMax << "\n";
     of << "Number of constraints:     " << n_B_ << endl;
-    SparseMatrix<double> A( n_A_ + n_B_, unknowns.size() );
-    A.setFromTriplets( AB_.begin(), AB_.end() );
-    of << "Dimension of design matrix " << A.rows() << "x" << A.cols() << endl;
-    AB_.clear();
-    AB_.shrink_to_fit();
-
-    //    MatrixXd A( A_.rows() + B_.rows(), A_.cols() );
-    //    A << A_, B_;
 
-    // dummyMatrixToFile(A_,"A.txt");
-
-    //    VectorXd P( P_A_.size() + P_B_.size() );
-    //    P << P_A_, P_B_;
-    MatrixXd o_c( A.rows(), obs_minus_com_.cols() );
-    o_c << obs_minus_com_, MatrixXd::Zero( n_B_, obs_minus_com_.cols() );
-    o_c *= speedOfLight * 100;
+    string solver = xml_.get( "VieSchedpp.solver.algorithm", "completeOrthogonalDecomposition" );
 
-    MatrixXd N = A.transpose() * P_AB_.asDiagonal() * A;
-    MatrixXd n = A.transpose() * P_AB_.asDiagonal() * o_c;
-    addDatum_stations( N, n );
-    addDatum_sources( N, n );
+    // normal equations (kept sparse for sparse solver)
+    SparseMatrix<double> A;
+    MatrixXd o_c;
+    MatrixXd N;
+    SparseMatrix<double> N_sparse;
+    MatrixXd n;
+    if ( streaming_ ) {
+        of << "Normal equations accumulated scan by scan (design matrix is not stored)" << endl;
+        if ( sparse_ ) {
+            mergeNormalMatrix();
+            N_sparse = std::move( N_sparse_ );
+        } else {
+            N = std::move( N_ );
+        }
+        n = std::move( n_ );
+    } else {
+        A = SparseMatrix<double>( n_A_ + n_B_, unknowns.size() );
+        A.setFromTriplets( AB_.begin(), AB_.end() );
+        of << "Dimension of design matrix " << A.rows() << "x" << A.cols() << endl;
+        trackMemory( AB_.capacity() * sizeof( Triplet<double> ) + memory( A ) + memory( obs_minus_com_ ) +
+                     memory( P_AB_ ) );
+        AB_.clear();
+        AB_.shrink_to_fit();
+
+        o_c = MatrixXd( A.rows(), obs_minus_com_.cols() );
+        o_c << obs_minus_com_, MatrixXd::Zero( n_B_, obs_minus_com_.cols() );
+        o_c *= speedOfLight * 100;
+
+        if ( solver == "sparseLDLT" ) {
+            SparseMatrix<double> PA = P_AB_.asDiagonal() * A;
+            N_sparse = A.transpose() * PA;
+            n = PA.transpose() * o_c;
+            trackMemory( memory( A ) + memory( PA ) + memory( obs_minus_com_ ) + memory( P_AB_ ) + memory( o_c ) +
+                         memory( N_sparse ) + memory( n ) );
+        } else {
+            N = A.transpose() * P_AB_.asDiagonal() * A;
+            n = A.transpose() * P_AB_.asDiagonal() * o_c;
+            trackMemory( memory( A ) + memory( obs_minus_com_ ) + memory( P_AB_ ) + memory( o_c ) + memory( N ) +
+                         memory( n ) );
+        }
+    }
+
+    // datum conditions of sparse solver (imposed after factorization)
+    MatrixXd datum;
+    if ( solver == "sparseLDLT" ) {
+        MatrixXd datumStations = datum_stations( N_sparse.cols() );
+        MatrixXd datumSources = datum_sources( N_sparse.cols() );
+        datum = MatrixXd( datumStations.rows() + datumSources.rows(), N_sparse.cols() );
+        datum.topRows( datumStations.rows() ) = datumStations;
+        datum.bottomRows( datumSources.rows() ) = datumSources;
+        addDatum( N_sparse, datum );
+        N_sparse.makeCompressed();
+        of << "Non-zeros of normal matrix " << N_sparse.nonZeros() << " ("
+           << boost::format( "%.2f%%" ) %
+                  ( 100.0 * N_sparse.nonZeros() / ( static_cast<double>( N_sparse.rows() ) * N_sparse.cols() ) )
+           << ")" << endl;
+    } else {
+        addDatum( N, n, datum_stations( N.cols() ) );
+        addDatum( N, n, datum_sources( N.cols() ) );
+    }
 
-    if (xml_.get("VieSchedpp.solver.output.A", false)){
+    if ( streaming_ &&
+         ( xml_.get( "VieSchedpp.solver.output.A", false ) || xml_.get( "VieSchedpp.solver.output.l", false ) ) ) {
+        of << "[WARNING] design matrix and o-c are not stored in streaming mode - no output files written" << endl;
+    }
+    if (!streaming_ && xml_.get("VieSchedpp.solver.output.A", false)){
         string file = path_;
         file.append( getName() ).append( "_A.csv" );
         ofstream of_tmp( file );
@@ -489,7 +564,7 @@ void Solver::solve() {
         ofstream of_tmp( file );
         of_tmp << P_AB_.format(IOFormat(StreamPrecision, DontAlignCols, ",", "\n"));
     }
-    if (xml_.get("VieSchedpp.solver.output.l", false)){
+    if (!streaming_ && xml_.get("VieSchedpp.solver.output.l", false)){
         string file = path_;
         file.append( getName() ).append( "_l.csv" );
         ofstream of_tmp( file );
@@ -502,8 +577,28 @@ void Solver::solve() {
     //     dummyMatrixToFile(N,"N.txt");
 
     MatrixXd x;
-    string solver = xml_.get( "VieSchedpp.solver.algorithm", "completeOrthogonalDecomposition" );
-    if ( solver == "completeOrthogonalDecomposition" ) {
+    // sparse solver: N + B'B is factorized, the datum B x = 0 is imposed by a correction of rank nd:
+    // x = N^-1 n - C S^-1 B N^-1 n with C = N^-1 B' and S = B C (N stands for N + B'B)
+    SimplicialLDLT<SparseMatrix<double>> sparseLDLT;
+    MatrixXd C;
+    LDLT<MatrixXd> S;
+    if ( solver == "sparseLDLT" ) {
+        of << "using sparse LDLT decomposition with AMD ordering ";
+
+        sparseLDLT.compute( N_sparse );
+        if ( sparseLDLT.info() != Success ) {
+            of << "[WARNING] matrix is most likely singular or at least badly conditioned";
+            x = MatrixXd::Constant( n.rows(), n.cols(), numeric_limits<double>::quiet_NaN() );
+        } else {
+            x = sparseLDLT.solve( n );
+            if ( datum.rows() > 0 ) {
+                C = sparseLDLT.solve( datum.transpose() );
+                S.compute( datum * C );
+                x -= C * S.solve( datum * x );
+            }
+        }
+
+    } else if ( solver == "completeOrthogonalDecomposition" ) {
         of << "using complete orthogonal decomposition ";
 
         const auto &tmp = N.completeOrthogonalDecomposition();
@@ -534,10 +629,21 @@ void Solver::solve() {
     long long int usec = microseconds.count();
     of << "(" << util::milliseconds2string( usec ) << ")" << endl;
 
-    VectorXd vTPv(nsim_);
-    for (int i = 0; i < nsim_; ++i) {
-        VectorXd v = A * x.block(0, i, n_unk, 1) - o_c.col(i);
-        vTPv[i] = v.transpose() * P_AB_.asDiagonal() * v;
+    VectorXd vTPv;
+    if ( streaming_ ) {
+        // second pass over all scans - residuals are accumulated with final estimates
+        x_ = x.topRows( n_unk );
+        vTPv_ = VectorXd::Zero( nsim_ );
+        residualPass_ = true;
+        buildConstraintsMatrix();
+        buildDesignMatrix();
+        residualPass_ = false;
+        vTPv = move( vTPv_ );
+        x_.resize( 0, 0 );
+        cachedObsMinusCom_.resize( 0, 0 );
+        cachedScan_ = -1;
+    } else {
+        vTPv = weightedSquaredResiduals( A, x, o_c );
     }
     //    dummyMatrixToFile(vTPv, "vTPv.txt");
     //    MatrixXd v = A * x - o_c;
@@ -557,7 +663,7 @@ void Solver::solve() {
 //        }
 //    }
 
-    int red = A.rows() - unknowns.size();
+    int red = static_cast<int>( n_A_ + n_B_ ) - static_cast<int>( unknowns.size() );
     of << "redundancy:                " << red << endl;
     VectorXd m0 = ( vTPv / red ).array().sqrt();
     of << "chi^2:                     " << m0.mean() << " +/- " << fun_std( m0 ) << endl;
@@ -565,7 +671,18 @@ void Solver::solve() {
     if (!xml_.get("VieSchedpp.solver.repeatablity_only", false)) {
         of << "calculating mean formal errors ";
         start = std::chrono::high_resolution_clock::now();
-        VectorXd tmp = N.inverse().diagonal().array().sqrt();
+        VectorXd tmp;
+        if ( solver == "sparseLDLT" ) {
+            VectorXd diag = selectedInverseDiagonal( sparseLDLT );
+            if ( C.size() > 0 ) {
+                // diagonal of C S^-1 C'
+                diag -= ( C.array() * S.solve( C.transpose() ).transpose().array() ).rowwise().sum().matrix();
+            }
+            tmp = diag.array().sqrt();
+        } else {
+            trackMemory( 2 * memory( N ) + memory( n ) + memory( x ) );
+            tmp = N.inverse().diagonal().array().sqrt();
+        }
         MatrixXd sigma_x = tmp * m0.transpose();
         mean_sig_ = sigma_x.rowwise().mean();
         finish = std::chrono::high_resolution_clock::now();
@@ -587,6 +704,8 @@ void Solver::solve() {
     if ( singular_ ) {
         of << "WARNING: Matrix is singular!\n";
     }
+    trackMemory( memory( N ) + memory( N_sparse ) + memory( n ) + memory( x ) );
+    of << boost::format( "estimated peak memory:     %.1f MB\n" ) % ( peakMemory_ / ( 1024. * 1024. ) );
 
 
     if (nsim_ > 1) {
@@ -603,8 +722,87 @@ void Solver::solve() {
     listUnknowns();
 }
 
-void Solver::addDatum_stations( MatrixXd &N, MatrixXd &n ) {
-    MatrixXd dat = MatrixXd::Zero( 6, N.cols() );
+void Solver::accumulateRows( unsigned long row0, unsigned long nRows, bool observations ) {
+    SparseMatrix<double> Ai( nRows, unknowns.size() );
+    for ( auto &t : AB_ ) {
+        t = Triplet<double>( t.row() - row0, t.col(), t.value() );
+    }
+    Ai.setFromTriplets( AB_.begin(), AB_.end() );
+    trackMemory( AB_.capacity() * sizeof( Triplet<double> ) + memory( Ai ) + memory( N_ ) + memory( N_sparse_ ) +
+                 N_triplets_.capacity() * sizeof( Triplet<double> ) + memory( n_ ) + memory( x_ ) +
+                 memory( cachedObsMinusCom_ ) + memory( P_AB_ ) );
+    AB_.clear();
+
+    const auto &Pi = P_AB_.segment( row0, nRows );
+    if ( residualPass_ ) {
+        MatrixXd v = Ai * x_;
+        if ( observations ) {
+            v -= obsMinusCom( row0, nRows ) * ( speedOfLight * 100 );
+        }
+        vTPv_ += ( v.array().square().colwise() * Pi.array() ).colwise().sum().transpose().matrix();
+        return;
+    }
+
+    SparseMatrix<double> PAi = Pi.asDiagonal() * Ai;
+    SparseMatrix<double> Ni = Ai.transpose() * PAi;
+    if ( sparse_ ) {
+        // elements are collected and merged from time to time (adding each block would copy N_sparse_ every time)
+        for ( int k = 0; k < Ni.outerSize(); ++k ) {
+            for ( SparseMatrix<double>::InnerIterator it( Ni, k ); it; ++it ) {
+                N_triplets_.emplace_back( it.row(), it.col(), it.value() );
+            }
+        }
+        if ( N_triplets_.size() > max( 1ul << 20, 2ul * N_sparse_.nonZeros() ) ) {
+            mergeNormalMatrix();
+        }
+    } else {
+        // sparse product is added to the non-zero elements only (no dense temporary)
+        N_ += Ni;
+    }
+
+    if ( observations ) {
+        MatrixXd Li = obsMinusCom( row0, nRows ) * ( speedOfLight * 100 );
+        n_ += PAi.transpose() * Li;
+    }
+}
+
+void Solver::mergeNormalMatrix() {
+    SparseMatrix<double> tmp( N_sparse_.rows(), N_sparse_.cols() );
+    tmp.setFromTriplets( N_triplets_.begin(), N_triplets_.end() );
+    N_sparse_ += tmp;
+    N_triplets_.clear();
+}
+
+MatrixXd Solver::obsMinusCom( unsigned long row0, unsigned long nRows ) {
+    if ( !streaming_ ) {
+        return obs_minus_com_.middleRows( row0, nRows );
+    }
+
+    MatrixXd o_c( nRows, nsim_ );
+    for ( unsigned long i = 0; i < nRows; ++i ) {
+        const auto &row = obsRow_[row0 + i];
+        if ( cachedScan_ != static_cast<long>( row.first ) ) {
+            cachedObsMinusCom_ = simulator_.obsMinusCom( row.first, scans_[row.first] );
+            cachedScan_ = static_cast<long>( row.first );
+        }
+        o_c.row( i ) = cachedObsMinusCom_.row( row.second );
+    }
+    return o_c;
+}
+
+void Solver::trackMemory( double bytes ) { peakMemory_ = max( peakMemory_, bytes ); }
+
+double Solver::memory( const MatrixXd &M ) { return static_cast<double>( M.size() ) * sizeof( double ); }
+
+double Solver::memory( const VectorXd &v ) { return static_cast<double>( v.size() ) * sizeof( double ); }
+
+double Solver::memory( const SparseMatrix<double> &M ) {
+    return static_cast<double>( M.nonZeros() ) * ( sizeof( double ) + sizeof( int ) ) +
+           static_cast<double>( M.outerSize() + 1 ) * sizeof( int );
+}
+
+MatrixXd Solver::datum_stations( long nCols ) {
+    MatrixXd dat = MatrixXd::Zero( 6, nCols );
     bool stationInDatum = false;
 
     double cc = 0;
@@ -649,21 +847,16 @@ void Solver::addDatum_stations( MatrixXd &N, MatrixXd &n ) {
             ++c;
         }
     }
+    of << "Number of datum stations:  " << c << endl;
 
-    if ( stationInDatum ) {
-        N.conservativeResize( N.rows() + 6, N.cols() + 6 );
-        N.block( N.rows() - 6, 0, 6, dat.cols() ) = dat;
-        N.block( 0, N.cols() - 6, dat.cols(), 6 ) = dat.transpose();
-        N.block( N.rows() - 6, N.rows() - 6, 6, 6 ) = MatrixXd::Zero( 6, 6 );
-
-        n.conservativeResize( n.rows() + 6, n.cols() );
-        n.block( n.rows() - 6, 0, 6, n.cols() ) = MatrixXd::Zero( 6, n.cols() );
+    if ( !stationInDatum ) {
+        return MatrixXd( 0, nCols );
     }
-    of << "Number of datum stations:  " << c << endl;
+    return dat;
 }
 
-void Solver::addDatum_sources( MatrixXd &N, MatrixXd &n ) {
-    MatrixXd dat = MatrixXd::Zero( 4, N.cols() );
+MatrixXd Solver::datum_sources( long nCols ) {
+    MatrixXd dat = MatrixXd::Zero( 4, nCols );
     bool sourceInDatum = false;
 
     int c = 0;
@@ -690,17 +883,126 @@ void Solver::addDatum_sources( MatrixXd &N, MatrixXd &n ) {
             ++c;
         }
     }
+    of << "Number of datum sources:   " << c << endl;
 
-    if ( sourceInDatum ) {
-        N.conservativeResize( N.rows() + 4, N.cols() + 4 );
-        N.block( N.rows() - 4, 0, 4, dat.cols() ) = dat;
-        N.block( 0, N.cols() - 4, dat.cols(), 4 ) = dat.transpose();
-        N.block( N.rows() - 4, N.rows() - 4, 4, 4 ) = MatrixXd::Zero( 4, 4 );
+    if ( !sourceInDatum ) {
+        return MatrixXd( 0, nCols );
+    }
+    return dat;
+}
 
-        n.conservativeResize( n.rows() + 4, n.cols() );
-        n.block( n.rows() - 4, 0, 4, n.cols() ) = MatrixXd::Zero( 4, n.cols() );
+void Solver::addDatum( MatrixXd &N, MatrixXd &n, const MatrixXd &dat ) {
+    long nd = dat.rows();
+    if ( nd == 0 ) {
+        return;
     }
-    of << "Number of datum sources:   " << c << endl;
+    N.conservativeResize( N.rows() + nd, N.cols() + nd );
+    N.block( N.rows() - nd, 0, nd, dat.cols() ) = dat;
+    N.block( 0, N.cols() - nd, dat.cols(), nd ) = dat.transpose();
+    N.block( N.rows() - nd, N.rows() - nd, nd, nd ) = MatrixXd::Zero( nd, nd );
+
+    n.conservativeResize( n.rows() + nd, n.cols() );
+    n.block( n.rows() - nd, 0, nd, n.cols() ) = MatrixXd::Zero( nd, n.cols() );
+}
+
+void Solver::addDatum( SparseMatrix<double> &N, const MatrixXd &dat ) {
+    if ( dat.rows() == 0 ) {
+        return;
+    }
+    // only columns of unknowns in datum
+    vector<long> cols;
+    for ( long c = 0; c < dat.cols(); ++c ) {
+        if ( !dat.col( c ).isZero() ) {
+            cols.push_back( c );
+        }
+    }
+    vector<Triplet<double>> triplets;
+    triplets.reserve( cols.size() * cols.size() );
+    for ( long c1 : cols ) {
+        for ( long c2 : cols ) {
+            double v = dat.col( c1 ).dot( dat.col( c2 ) );
+            if ( v != 0 ) {
+                triplets.emplace_back( c1, c2, v );
+            }
+        }
+    }
+    SparseMatrix<double> BTB( N.rows(), N.cols() );
+    BTB.setFromTriplets( triplets.begin(), triplets.end() );
+    N += BTB;
+}
+
+VectorXd Solver::weightedSquaredResiduals( const SparseMatrix<double> &A, const MatrixXd &x,
+                                           const MatrixXd &o_c ) const {
+    long n_unk = A.cols();
+    long nsim = o_c.cols();
+    VectorXd vTPv( nsim );
+
+    // blocks of simulation runs: one pass over A per block, memory limited to (number of rows) x (block size)
+    const long blockSize = 32;
+    long nBlocks = ( nsim + blockSize - 1 ) / blockSize;
+
+#ifdef _OPENMP
+    bool parallel = nBlocks > 1 && omp_get_max_threads() > 1 && !omp_in_parallel();
+#pragma omp parallel for schedule( dynamic ) if ( parallel )
+#endif
+    for ( long iblock = 0; iblock < nBlocks; ++iblock ) {
+        SchedulingContext::Scope scope( context_ );
+        long c0 = iblock * blockSize;
+        long nc = min( blockSize, nsim - c0 );
+        MatrixXd v = A * x.block( 0, c0, n_unk, nc ) - o_c.middleCols( c0, nc );
+        vTPv.segment( c0, nc ) = ( v.array().square().colwise() * P_AB_.array() ).colwise().sum().transpose();
+    }
+    return vTPv;
+}
+
+VectorXd Solver::selectedInverseDiagonal( const SimplicialLDLT<SparseMatrix<double>> &ldlt ) {
+    long n = ldlt.rows();
+    VectorXd diag = VectorXd::Constant( n, numeric_limits<double>::quiet_NaN() );
+    if ( ldlt.info() != Success ) {
+        return diag;
+    }
+
+    // L is unit lower triangular (diagonal not stored), row indices of each column are sorted
+    const SparseMatrix<double> &L = ldlt.matrixL().nestedExpression();
+    const VectorXd &D = ldlt.vectorD();
+    const int *Lp = L.outerIndexPtr();
+    const int *Li = L.innerIndexPtr();
+    const double *Lx = L.valuePtr();
+
+    // elements of Z = (L D L')^-1 on pattern of L
+    vector<double> Z( L.nonZeros() );
+    VectorXd Zdiag( n );
+    // Z(r,c) for r,c in pattern of column j (the pattern of L is closed under this access)
+    auto z = [&]( int r, int c ) {
+        if ( r == c ) {
+            return Zdiag( r );
+        }
+        if ( r < c ) {
+            swap( r, c );
+        }
+        const int *p = lower_bound( Li + Lp[c], Li + Lp[c + 1], r );
+        return Z[p - Li];
+    };
+
+    for ( long j = n - 1; j >= 0; --j ) {
+        double d = 1 / D( j );
+        for ( int a = Lp[j]; a < Lp[j + 1]; ++a ) {
+            double sum = 0;
+            for ( int b = Lp[j]; b < Lp[j + 1]; ++b ) {
+                sum += z( Li[a], Li[b] ) * Lx[b];
+            }
+            Z[a] = -sum;
+            d += sum * Lx[a];
+        }
+        Zdiag( j ) = d;
+    }
+
+    // undo fill-reducing ordering
+    const auto &perm = ldlt.permutationP().indices();
+    for ( long i = 0; i < n; ++i ) {
+        diag( i ) = Zdiag( perm( i ) );
+    }
+    return diag;
 }
 
 Solver::Partials Solver::partials( const Observation &obs, const Matrix3d &t2c, const Matrix3d &dQdx,
@@ -973,6 +1275,8 @@ Matrix3d Solver::drotm( double angle, Axis ax ) {
 
 void Solver::readXML() {
     const auto &tree = xml_.get_child( "VieSchedpp.solver" );
+    streaming_ = tree.get( "streaming", false );
+    sparse_ = tree.get( "algorithm", "completeOrthogonalDecomposition" ) == "sparseLDLT";
 
     string refClock = tree.get( "reference_clock", "" );
     if ( refClock.empty() ) {
@@ -1591,7 +1895,7 @@ void Solver::simSummary() {
 
 }
 
-void Solver::writeStatistics( std::ofstream &stat_of ) {
+void Solver::writeStatistics( StatisticsTable &statistics ) {
     string oString;
 
     auto n_scans = static_cast<int>( scans_.size() );
@@ -1982,10 +2286,7 @@ void Solver::writeStatistics( std::ofstream &stat_of ) {
         }
     }
 
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-    { stat_of << oString << endl; };
+    statistics.addRow( version_, oString );
 }
 
 void Solver::readObslist() {
@@ -31,6 +31,7 @@
 // clang-format off
 #include <utility>
 #include "../Eigen/SparseCore"
+#include "../Eigen/SparseCholesky"
 
 #include "Simulator.h"
 #include "Unknown.h"
@@ -38,6 +39,10 @@
 #include "../Misc/AstronomicalParameters.h"
 #include <boost/algorithm/string.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 namespace VieVS {
 
@@ -55,6 +60,8 @@ class Solver : public VieVS_NamedObject {
      * @brief constructor
      * @author Matthias Schartner
      *
+     * in streaming mode the simulator provides the observed minus computed scan by scan and has to outlive the solver
+     *
      * @param simulator scheduler
      */
     explicit Solver(Simulator &simulator);
@@ -66,12 +73,12 @@ class Solver : public VieVS_NamedObject {
     std::vector<double> getRepeatabilities();
 
     /**
-     * @brief write statistics line to statistics.csv file
+     * @brief add statistics of this simulation to statistics table
      * @author Matthias Schartner
      *
-     * @param of statistics.csv file
+     * @param statistics statistics table
      */
-    void writeStatistics( std::ofstream &of );
+    void writeStatistics( StatisticsTable &statistics );
 
     void simSummary();
 
@@ -165,10 +172,12 @@ class Solver : public VieVS_NamedObject {
 
     const boost::property_tree::ptree xml_;  ///< content of VieSchedpp.xml file
 
+    const Simulator &simulator_;     ///< simulator (provides o-c scan by scan in streaming mode)
+    const SchedulingContext context_;  ///< session parameters (applied on worker threads of parallel loops)
     const Network network_;          ///< network
     const SourceList sourceList_;    ///< all sources
     const std::vector<Scan> scans_;  ///< all scans in schedule
-    Eigen::MatrixXd obs_minus_com_;
+    Eigen::MatrixXd obs_minus_com_;  ///< observed minus computed (empty in streaming mode)
     const int version_;                                                       ///< number of this schedule
     const std::string path_; ///< path
     boost::optional<MultiScheduling::Parameters> multiSchedulingParameters_;  ///< multi scheduling parameters
@@ -186,6 +195,20 @@ class Solver : public VieVS_NamedObject {
     unsigned long n_A_;
     unsigned long n_B_;
     Eigen::VectorXd P_AB_;
+    bool streaming_ = false;                          ///< accumulate normal equations scan by scan (no design matrix)
+    bool sparse_ = false;                             ///< sparse normal equations (sparseLDLT algorithm)
+    bool residualPass_ = false;                       ///< second pass computes residuals (streaming mode only)
+    Eigen::MatrixXd N_;                               ///< accumulated normal matrix (streaming, dense algorithms)
+    Eigen::SparseMatrix<double> N_sparse_;            ///< accumulated normal matrix (streaming, sparseLDLT)
+    std::vector<Eigen::Triplet<double>> N_triplets_;  ///< elements not yet merged into N_sparse_
+    Eigen::MatrixXd n_;                               ///< accumulated right hand side (streaming mode only)
+    Eigen::MatrixXd x_;                               ///< estimates used in residual pass (streaming mode only)
+    Eigen::VectorXd vTPv_;                            ///< weighted squared residuals per run (streaming mode only)
+    double peakMemory_ = 0;                           ///< estimated peak memory of solver data structures in bytes
+
+    std::vector<std::pair<unsigned long, unsigned long>> obsRow_;  ///< scan and observation of o-c rows
+    long cachedScan_ = -1;                                         ///< scan of cachedObsMinusCom_ (-1 if none)
+    Eigen::MatrixXd cachedObsMinusCom_;                            ///< o-c of last requested scan
     //    Eigen::MatrixXd A_;
     //    Eigen::VectorXd P_A_;
     //    Eigen::MatrixXd B_;
@@ -217,9 +240,94 @@ class Solver : public VieVS_NamedObject {
 
     void solve();
 
-    void addDatum_stations( Eigen::MatrixXd &N, Eigen::MatrixXd &n );
+    Eigen::MatrixXd datum_stations( long nCols );
+
+    Eigen::MatrixXd datum_sources( long nCols );
+
+    static void addDatum( Eigen::MatrixXd &N, Eigen::MatrixXd &n, const Eigen::MatrixXd &dat );
+
+    /**
+     * @brief add datum conditions B x = 0 to sparse normal matrix as B'B
+     * @author Matthias Schartner
+     *
+     * N + B'B is positive definite if the datum removes the rank defect. The bordered system with N + B'B has the
+     * same solution and the same inverse (upper left block) as the one with N.
+     *
+     * @param N normal matrix
+     * @param dat datum conditions B
+     */
+    static void addDatum( Eigen::SparseMatrix<double> &N, const Eigen::MatrixXd &dat );
+
+    /**
+     * @brief add block of rows of design matrix to normal equations (or residuals) and release it
+     * @author Matthias Schartner
+     *
+     * used in streaming mode - rows are taken from current triplets. During the residual pass the weighted squared
+     * residuals of the final estimates are accumulated instead.
+     *
+     * @param row0 index of first row in block
+     * @param nRows number of rows in block
+     * @param observations true for observation rows, false for constraints (zero o-c)
+     */
+    void accumulateRows( unsigned long row0, unsigned long nRows, bool observations );
+
+    /**
+     * @brief merge collected triplets into sparse normal matrix
+     * @author Matthias Schartner
+     */
+    void mergeNormalMatrix();
+
+    /**
+     * @brief rows of observed minus computed
+     * @author Matthias Schartner
+     *
+     * in streaming mode the o-c rows are requested scan by scan from the simulator
+     *
+     * @param row0 first row
+     * @param nRows number of rows
+     * @return observed minus computed in seconds
+     */
+    Eigen::MatrixXd obsMinusCom( unsigned long row0, unsigned long nRows );
+
+    /**
+     * @brief keep track of estimated peak memory
+     * @author Matthias Schartner
+     *
+     * @param bytes memory currently in use
+     */
+    void trackMemory( double bytes );
+
+    static double memory( const Eigen::MatrixXd &M );
+
+    static double memory( const Eigen::SparseMatrix<double> &M );
+
+    static double memory( const Eigen::VectorXd &v );
 
-    void addDatum_sources( Eigen::MatrixXd &N, Eigen::MatrixXd &n );
+    /**
+     * @brief weighted sum of squared residuals of all simulation runs
+     * @author Matthias Schartner
+     *
+     * residuals are computed for blocks of simulation runs as one sparse times dense product
+     *
+     * @param A design matrix
+     * @param x estimates (one column per simulation run)
+     * @param o_c observed minus computed (one column per simulation run)
+     * @return vTPv per simulation run
+     */
+    Eigen::VectorXd weightedSquaredResiduals( const Eigen::SparseMatrix<double> &A, const Eigen::MatrixXd &x,
+                                              const Eigen::MatrixXd &o_c ) const;
+
+    /**
+     * @brief diagonal of inverse of factorized sparse normal matrix (selected inversion)
+     * @author Matthias Schartner
+     *
+     * Takahashi recurrence on the LDL' factor: elements of the inverse are only computed on the non-zero pattern of
+     * L, starting from the last column. Cost is about the sum of squared column counts of L.
+     *
+     * @param ldlt factorized normal matrix
+     * @return diagonal elements in original order (NaN if factorization failed)
+     */
+    static Eigen::VectorXd selectedInverseDiagonal( const Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> &ldlt );
 
 
     static Eigen::Matrix3d rotm( double angle, Axis ax );
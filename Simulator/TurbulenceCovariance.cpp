@@ -0,0 +1,96 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * File:   TurbulenceCovariance.cpp
+ * Author: mschartn
+ *
+ * 17.10.2026
+ */
+
+#include "TurbulenceCovariance.h"
+
+#ifdef SIMULATOR_MODE
+
+using namespace std;
+using namespace VieVS;
+using namespace Eigen;
+
+
+TurbulenceCovariance::TurbulenceCovariance( const vector<double> &az, const vector<double> &el,
+                                            const vector<double> &time, double Cn, double H, double dh, double vn,
+                                            double ve )
+    : Cnall_{ Cn * Cn / 2 * 1e6 * dh * dh }, v_{ vn * 3600, ve * 3600, 0 } {
+    const unsigned long nobs = az.size();
+
+    // ray geometry of all observations
+    t_h_.resize( nobs );
+    r_.resize( nobs );
+    for ( unsigned long i = 0; i < nobs; ++i ) {
+        t_h_( i ) = time[i] / 3600.;
+        r_[i] = Vector3d( cos( az[i] ) / tan( el[i] ), sin( az[i] ) / tan( el[i] ), 1 );
+    }
+
+    // height layers
+    const int nh = floor( H / dh );
+    const int nz = nh + 1;
+    z_ = ArrayXd::LinSpaced( nz, 0, nh * dh );
+    dist2_.resize( nz * nz );
+    rho_.resize( nz * nz );
+
+    // squared distances between layers z and zs
+    for ( int izs = 0; izs < nz; ++izs ) {
+        dist2_.segment( izs * nz, nz ) = ( z_ - z_( izs ) ).square();
+    }
+    rho4Sum_ = structureSum();
+
+    // terms which only depend on one observation
+    rhoSum_.resize( nobs );
+    for ( unsigned long i = 0; i < nobs; ++i ) {
+        const Vector3d &ri = r_[i];
+        Vector3d w = v_ * t_h_( i );
+        for ( int izs = 0; izs < nz; ++izs ) {
+            dist2_.segment( izs * nz, nz ) = ( ri.x() * z_ + w.x() ).square() + ( ri.y() * z_ + w.y() ).square() +
+                                             ( ri.z() * z_ - z_( izs ) + w.z() ).square();
+        }
+        rhoSum_( i ) = structureSum();
+    }
+}
+
+
+double TurbulenceCovariance::operator()( unsigned long i1, unsigned long i2 ) {
+    const long nz = z_.size();
+    const Vector3d &r1 = r_[i1];
+    const Vector3d &r2 = r_[i2];
+    Vector3d w = v_ * ( t_h_( i2 ) - t_h_( i1 ) );
+    for ( long izs = 0; izs < nz; ++izs ) {
+        Vector3d b = r2 * z_( izs ) + w;
+        dist2_.segment( izs * nz, nz ) = ( r1.x() * z_ - b.x() ).square() + ( r1.y() * z_ - b.y() ).square() +
+                                         ( r1.z() * z_ - b.z() ).square();
+    }
+    return Cnall_ * ( rhoSum_( i1 ) + rhoSum_( i2 ) - structureSum() - rho4Sum_ );
+}
+
+
+double TurbulenceCovariance::structureSum() {
+    static const double L23 = pow( 3e6, 2.0 / 3.0 );
+    rho_ = ( dist2_.log() / 3 ).exp();
+    return ( rho_ / ( 1 + rho_ / L23 ) ).sum();
+}
+
+#endif
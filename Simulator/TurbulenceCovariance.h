@@ -0,0 +1,106 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file TurbulenceCovariance.h
+ * @brief class TurbulenceCovariance
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+
+#ifndef VIESCHEDPP_TURBULENCECOVARIANCE_H
+#define VIESCHEDPP_TURBULENCECOVARIANCE_H
+
+#ifdef SIMULATOR_MODE
+
+#include <vector>
+
+// clang-format off
+#include "../Eigen/Dense"
+// clang-format on
+
+namespace VieVS {
+
+/**
+ * @class TurbulenceCovariance
+ * @brief covariance of slant wet delays of one station based on the turbulence model of Nilsson and Haas (2010)
+ *
+ * The ray geometry and all terms which only depend on a single observation are computed once in the constructor.
+ * For a pair of observations, all (nh+1)^2 combinations of the height layers are evaluated at once in buffers which
+ * are allocated once (cbrt(x) = exp(log(x)/3)).
+ *
+ * The buffers are reused between calls, use one object per thread.
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+class TurbulenceCovariance {
+   public:
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * @param az azimuth of all observations in radians
+     * @param el elevation of all observations in radians
+     * @param time time of all observations in seconds
+     * @param Cn refractive index structure constant
+     * @param H effective height of the wet troposphere in meters
+     * @param dh integration step size in meters
+     * @param vn wind velocity towards north in meters per second
+     * @param ve wind velocity towards east in meters per second
+     */
+    TurbulenceCovariance( const std::vector<double> &az, const std::vector<double> &el,
+                          const std::vector<double> &time, double Cn, double H, double dh, double vn, double ve );
+
+
+    /**
+     * @brief covariance between two observations
+     * @author Matthias Schartner
+     *
+     * @param i1 index of first observation
+     * @param i2 index of second observation
+     * @return covariance of zenith wet delays in mm^2
+     */
+    double operator()( unsigned long i1, unsigned long i2 );
+
+
+   private:
+    double Cnall_;                      ///< scaling factor
+    Eigen::Vector3d v_;                 ///< wind velocity in meters per hour
+    Eigen::VectorXd t_h_;               ///< observation times in hours
+    std::vector<Eigen::Vector3d> r_;    ///< ray direction per meter height
+    Eigen::ArrayXd z_;                  ///< height layers
+    Eigen::ArrayXd dist2_;              ///< squared distances between all layer combinations
+    Eigen::ArrayXd rho_;                ///< buffer for structure function
+    double rho4Sum_;                    ///< structure function term between height layers
+    Eigen::VectorXd rhoSum_;            ///< structure function term per observation
+
+    /**
+     * @brief sum of saturated structure function over all squared distances in dist2_
+     * @author Matthias Schartner
+     *
+     * @return sum of structure function
+     */
+    double structureSum();
+};
+
+}  // namespace VieVS
+
+#endif
+#endif  // VIESCHEDPP_TURBULENCECOVARIANCE_H
@@ -124,6 +124,6 @@ std::string Unknown::toString( string datum ) const {
     string m = member.empty() ? "--" : member;
     string e = refTime == std::numeric_limits<int>::min()
                    ? "--"
-                   : TimeSystem::time2string( TimeSystem::startTime + boost::posix_time::seconds( refTime ) );
+                   : TimeSystem::time2string( TimeSystem::startTime.get() + boost::posix_time::seconds( refTime ) );
     return ( boost::format( "| %-9s | %-8s | %-19s |" ) % t % m % e ).str();
 }
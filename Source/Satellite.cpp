@@ -44,7 +44,7 @@ std::pair<std::pair<double, double>, std::vector<double>> Satellite::getSourceIn
 
 std::tuple<double, double, double, double> Satellite::calcRaDeDistTime(
     unsigned int time, const std::shared_ptr<const Position>& sta_pos ) const noexcept {
-    DateTime currentTime = TimeSystem::startSgp4.AddSeconds( time );
+    DateTime currentTime = TimeSystem::startSgp4.get().AddSeconds( time );
     unsigned long idx = 0;
     if ( pSGP4Data_.size() > 1 ) {
         boost::posix_time::ptime ref = TimeSystem::internalTime2PosixTime( time );
@@ -93,7 +93,7 @@ std::tuple<double, double, double, double> Satellite::calcRaDeDistTime(
 }
 
 pair<double, double> Satellite::calcRaDe( unsigned int time, const std::shared_ptr<const Position>& sta_pos ) const {
-    DateTime currentTime = TimeSystem::startSgp4.AddSeconds( time );
+    DateTime currentTime = TimeSystem::startSgp4.get().AddSeconds( time );
     unsigned long idx = 0;
     if ( pSGP4Data_.size() > 1 ) {
         boost::posix_time::ptime ref = TimeSystem::internalTime2PosixTime( time );
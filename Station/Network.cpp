@@ -23,7 +23,7 @@ using namespace VieVS;
 using namespace std;
 
 unsigned long VieVS::Network::nextId = 0;
-std::map<unsigned long, int> Network::station2site;
+thread_local SessionParameter<std::map<unsigned long, int>> Network::station2site;
 
 Network::Network() : VieVS_Object( nextId++ ) {
     nsta_ = 0;
@@ -152,6 +152,13 @@ Station &Network::refStation( const std::string &name ) {
 std::vector<Station> &Network::refStations() { return stations_; }
 
 
+void Network::setAzElCacheReadOnly( bool flag ) noexcept {
+    for ( auto &station : stations_ ) {
+        station.setAzElCacheReadOnly( flag );
+    }
+}
+
+
 Baseline &Network::refBaseline( unsigned long id ) { return baselines_[id]; }
 
 
@@ -227,7 +234,7 @@ const std::vector<double> &Network::getDxyz( unsigned long staid1, unsigned long
 }
 
 
-double Network::calcScore_skyCoverage( const vector<PointingVector> &pvs ) const {
+double Network::calcScore_skyCoverage( const PointingVectors &pvs ) const {
     double score = 0;
 
     for ( const auto &pv : pvs ) {
@@ -241,7 +248,7 @@ double Network::calcScore_skyCoverage( const vector<PointingVector> &pvs ) const
 }
 
 
-double Network::calcScore_skyCoverage( const vector<PointingVector> &pvs,
+double Network::calcScore_skyCoverage( const PointingVectors &pvs,
                                        unordered_map<unsigned long, double> &staids2skyCoverageScore ) const {
     double score = 0;
 
@@ -259,7 +266,7 @@ double Network::calcScore_skyCoverage( const vector<PointingVector> &pvs,
 
 
 double Network::calcScore_skyCoverage_subnetting(
-    const vector<PointingVector> &pvs, const unordered_map<unsigned long, double> &staids2skyCoverageScore ) const {
+    const PointingVectors &pvs, const unordered_map<unsigned long, double> &staids2skyCoverageScore ) const {
     double score = 0;
 
     for ( const auto &pv : pvs ) {
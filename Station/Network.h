@@ -33,6 +33,7 @@
 
 #include "../Misc/VieVS_Object.h"
 #include "../ObservingMode/ObservingMode.h"
+#include "../Misc/SessionParameter.h"
 #include "Baseline.h"
 #include "SkyCoverage.h"
 #include "Station.h"
@@ -193,6 +194,15 @@ class Network : public VieVS_Object {
     std::vector<Station> &refStations();
 
 
+    /**
+     * @brief lock or unlock the rigorous azimuth elevation side tables of all stations
+     * @author Matthias Schartner
+     *
+     * @param flag true if rigorous azimuth elevation calculations must not change the stations
+     */
+    void setAzElCacheReadOnly( bool flag ) noexcept;
+
+
     /**
      * @brief reference to baseline per id
      * @author Matthias Schartner
@@ -362,7 +372,7 @@ class Network : public VieVS_Object {
      * @param pvs list of pointing vectors
      * @return total score
      */
-    double calcScore_skyCoverage( const std::vector<PointingVector> &pvs ) const;
+    double calcScore_skyCoverage( const PointingVectors &pvs ) const;
 
 
     /**
@@ -375,7 +385,7 @@ class Network : public VieVS_Object {
      * @param staids2skyCoverageScore storage for results
      * @return total score
      */
-    double calcScore_skyCoverage( const std::vector<PointingVector> &pvs,
+    double calcScore_skyCoverage( const PointingVectors &pvs,
                                   std::unordered_map<unsigned long, double> &staids2skyCoverageScore ) const;
 
 
@@ -390,7 +400,7 @@ class Network : public VieVS_Object {
      * @return total score
      */
     double calcScore_skyCoverage_subnetting(
-        const std::vector<PointingVector> &pvs,
+        const PointingVectors &pvs,
         const std::unordered_map<unsigned long, double> &staids2skyCoverageScore ) const;
 
 
@@ -476,8 +486,8 @@ class Network : public VieVS_Object {
 
     std::map<std::pair<unsigned long, unsigned long>, unsigned long> staids2blid_;  ///< lookup table for baseline id
 
-    static unsigned long nextId;                       ///< next id for this object type
-    static std::map<unsigned long, int> station2site;  ///< station to site converter
+    static unsigned long nextId;                                    ///< next id for this object type
+    static thread_local SessionParameter<std::map<unsigned long, int>> station2site;  ///< station to site converter
 
     std::map<std::pair<unsigned long, unsigned long>, std::vector<double>>
         staids2dxyz_;  ///< lookup table for baseline vectors
@@ -0,0 +1,150 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PointingCache.h"
+
+
+using namespace std;
+using namespace VieVS;
+
+
+void PointingCache::initializeGrid( unsigned long srcid, unsigned int step, unsigned int nEpochs ) {
+    Grid &grid = mutableGrids()[srcid];
+    grid.step = step;
+    grid.az.assign( nEpochs, 0 );
+    grid.el.assign( nEpochs, 0 );
+    grid.ha.assign( nEpochs, 0 );
+    grid.dc.assign( nEpochs, 0 );
+}
+
+
+void PointingCache::setGridValue( unsigned long srcid, unsigned int idx, const PointingVector &p ) noexcept {
+    Grid &grid = mutableGrids()[srcid];
+    grid.az[idx] = p.getAz();
+    grid.el[idx] = p.getEl();
+    grid.ha[idx] = p.getHa();
+    grid.dc[idx] = p.getDc();
+}
+
+
+bool PointingCache::interpolate( unsigned long srcid, PointingVector &p ) const noexcept {
+    if ( !hasGrid( srcid ) ) {
+        return false;
+    }
+    const Grid &grid = ( *grids_ )[srcid];
+    unsigned int time = p.getTime();
+
+    // index of previous grid epoch (last interval is used for epochs after end of grid)
+    auto last = static_cast<unsigned int>( grid.az.size() - 1 );
+    unsigned int idx = time / grid.step;
+    if ( idx >= last ) {
+        idx = last - 1;
+    }
+    unsigned int t1 = idx * grid.step;
+
+    // check if a precalculated value matches time exactly
+    if ( time == t1 ) {
+        p.setAz( grid.az[idx] );
+        p.setEl( grid.el[idx] );
+        p.setHa( grid.ha[idx] );
+        p.setDc( grid.dc[idx] );
+        return true;
+    }
+
+    double factor = static_cast<double>( time - t1 ) / static_cast<double>( grid.step );
+
+    // azimuth and hour angle are interpolated along the shorter arc
+    double daz = grid.az[idx + 1] - grid.az[idx];
+    if ( daz > pi ) {
+        daz -= twopi;
+    } else if ( daz < -pi ) {
+        daz += twopi;
+    }
+    double az = grid.az[idx] + factor * daz;
+    if ( az >= twopi ) {
+        az -= twopi;
+    } else if ( az < 0 ) {
+        az += twopi;
+    }
+
+    double dha = grid.ha[idx + 1] - grid.ha[idx];
+    if ( dha > pi ) {
+        dha -= twopi;
+    } else if ( dha < -pi ) {
+        dha += twopi;
+    }
+    double ha = grid.ha[idx] + factor * dha;
+    if ( ha > pi ) {
+        ha -= twopi;
+    } else if ( ha < -pi ) {
+        ha += twopi;
+    }
+
+    double el = grid.el[idx] + factor * ( grid.el[idx + 1] - grid.el[idx] );
+    double dc = grid.dc[idx] + factor * ( grid.dc[idx + 1] - grid.dc[idx] );
+
+    p.setAz( az );
+    p.setEl( el );
+    p.setHa( ha );
+    p.setDc( dc );
+    return true;
+}
+
+
+bool PointingCache::lookupExact( unsigned long srcid, PointingVector &p ) const noexcept {
+    unsigned int time = p.getTime();
+
+    if ( hasGrid( srcid ) ) {
+        const Grid &grid = ( *grids_ )[srcid];
+        if ( time % grid.step == 0 && time / grid.step < grid.az.size() ) {
+            unsigned int idx = time / grid.step;
+            p.setAz( grid.az[idx] );
+            p.setEl( grid.el[idx] );
+            p.setHa( grid.ha[idx] );
+            p.setDc( grid.dc[idx] );
+            return true;
+        }
+    }
+
+    unsigned long long k = key( srcid, time );
+    auto it = rigorous_.find( k );
+    if ( it == rigorous_.end() ) {
+        it = rigorousPrevious_.find( k );
+        if ( it == rigorousPrevious_.end() ) {
+            return false;
+        }
+    }
+    p.setAz( it->second.az );
+    p.setEl( it->second.el );
+    p.setHa( it->second.ha );
+    p.setDc( it->second.dc );
+    return true;
+}
+
+
+void PointingCache::addRigorous( unsigned long srcid, const PointingVector &p ) noexcept {
+    if ( readOnly_ ) {
+        return;
+    }
+    // two generations: once the recent table is full it becomes the previous one and the oldest values are dropped
+    if ( rigorous_.size() >= maxRigorousEntries ) {
+        rigorousPrevious_ = move( rigorous_ );
+        rigorous_.clear();
+    }
+    rigorous_[key( srcid, p.getTime() )] = Entry{ p.getAz(), p.getEl(), p.getHa(), p.getDc() };
+}
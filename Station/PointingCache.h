@@ -0,0 +1,221 @@
+/*
+ *  VieSched++ Very Long Baseline Interferometry (VLBI) Scheduling Software
+ *  Copyright (C) 2018  Matthias Schartner
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file PointingCache.h
+ * @brief class PointingCache
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+
+#ifndef POINTINGCACHE_H
+#define POINTINGCACHE_H
+
+
+#include <cmath>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "../Misc/Constants.h"
+#include "../Scan/PointingVector.h"
+
+
+namespace VieVS {
+/**
+ * @class PointingCache
+ * @brief time indexed azimuth/elevation lookup table of one station
+ *
+ * For each source the azimuth, elevation, hour angle and declination are stored in an equidistant time grid
+ * (index = time / step) as contiguous arrays. Interpolation is therefore O(1). Values at grid epochs are the unchanged
+ * results of the rigorous model.
+ * Results of the rigorous model at arbitrary epochs are kept in a separate, bounded side table.
+ *
+ * The time grids are immutable once calculated and shared between copies of a cache (copy-on-write), so copies of a
+ * station (e.g. one per schedule in multi scheduling) do not duplicate them. The side table belongs to each copy.
+ *
+ * @author Matthias Schartner
+ * @date 17.10.2026
+ */
+class PointingCache {
+   public:
+    /**
+     * @brief constructor
+     * @author Matthias Schartner
+     *
+     * @param nSources number of sources
+     */
+    explicit PointingCache( unsigned long nSources = 0 )
+        : grids_{ std::make_shared<std::vector<Grid>>( nSources ) } {}
+
+
+    /**
+     * @brief number of sources covered by this cache
+     * @author Matthias Schartner
+     *
+     * @return number of sources
+     */
+    unsigned long getNSources() const noexcept { return grids_->size(); }
+
+
+    /**
+     * @brief check if a time grid is available for this source
+     * @author Matthias Schartner
+     *
+     * @param srcid source id
+     * @return true if grid is available
+     */
+    bool hasGrid( unsigned long srcid ) const noexcept {
+        return srcid < grids_->size() && ( *grids_ )[srcid].az.size() > 1;
+    }
+
+
+    /**
+     * @brief allocate time grid for one source
+     * @author Matthias Schartner
+     *
+     * @param srcid source id
+     * @param step grid spacing in seconds
+     * @param nEpochs number of grid epochs
+     */
+    void initializeGrid( unsigned long srcid, unsigned int step, unsigned int nEpochs );
+
+
+    /**
+     * @brief store a grid value
+     * @author Matthias Schartner
+     *
+     * @param srcid source id
+     * @param idx grid index (time = idx * step)
+     * @param p pointing vector holding azimuth, elevation, hour angle and declination
+     */
+    void setGridValue( unsigned long srcid, unsigned int idx, const PointingVector &p ) noexcept;
+
+
+    /**
+     * @brief interpolate azimuth, elevation, hour angle and declination from time grid
+     * @author Matthias Schartner
+     *
+     * All four values are interpolated linearly (azimuth and hour angle along the shorter arc). The declination is
+     * interpolated as well instead of taking the value of the following grid epoch.
+     *
+     * @param srcid source id
+     * @param p pointing vector which holds time information and will be filled with azimuth and elevation
+     * information
+     * @return false if no grid is available for this source
+     */
+    bool interpolate( unsigned long srcid, PointingVector &p ) const noexcept;
+
+
+    /**
+     * @brief look up an exact value (grid epoch or previous rigorous calculation)
+     * @author Matthias Schartner
+     *
+     * @param srcid source id
+     * @param p pointing vector which holds time information and will be filled with azimuth and elevation
+     * information
+     * @return true if a value was found
+     */
+    bool lookupExact( unsigned long srcid, PointingVector &p ) const noexcept;
+
+
+    /**
+     * @brief store result of rigorous model in side table
+     * @author Matthias Schartner
+     *
+     * @param srcid source id
+     * @param p calculated pointing vector
+     */
+    void addRigorous( unsigned long srcid, const PointingVector &p ) noexcept;
+
+
+    /**
+     * @brief lock or unlock the side table
+     * @author Matthias Schartner
+     *
+     * While the side table is locked addRigorous() does nothing, which makes concurrent lookups from several threads
+     * safe.
+     *
+     * @param flag true to lock the side table
+     */
+    void setReadOnly( bool flag ) noexcept { readOnly_ = flag; }
+
+   private:
+    /**
+     * @brief equidistant time grid of one source
+     * @author Matthias Schartner
+     */
+    struct Grid {
+        unsigned int step = 0;   ///< grid spacing in seconds
+        std::vector<double> az;  ///< azimuth in radians
+        std::vector<double> el;  ///< elevation in radians
+        std::vector<double> ha;  ///< hour angle in radians
+        std::vector<double> dc;  ///< declination in radians
+    };
+
+    /**
+     * @brief value of rigorous model
+     * @author Matthias Schartner
+     */
+    struct Entry {
+        double az;  ///< azimuth in radians
+        double el;  ///< elevation in radians
+        double ha;  ///< hour angle in radians
+        double dc;  ///< declination in radians
+    };
+
+    static const std::size_t maxRigorousEntries = 1u << 15u;  ///< size of one side table generation
+
+    bool readOnly_ = false;                                           ///< side table is locked
+    std::shared_ptr<std::vector<Grid>> grids_;                        ///< time grid per source (shared between copies)
+    std::unordered_map<unsigned long long, Entry> rigorous_;          ///< recent rigorous values
+    std::unordered_map<unsigned long long, Entry> rigorousPrevious_;  ///< previous generation of rigorous values
+
+
+    /**
+     * @brief time grids which can be modified
+     * @author Matthias Schartner
+     *
+     * copies the grids first if they are shared with other caches
+     *
+     * @return time grid per source
+     */
+    std::vector<Grid> &mutableGrids() {
+        if ( grids_.use_count() > 1 ) {
+            grids_ = std::make_shared<std::vector<Grid>>( *grids_ );
+        }
+        return *grids_;
+    }
+
+
+    /**
+     * @brief side table key
+     * @author Matthias Schartner
+     *
+     * @param srcid source id
+     * @param time time in seconds since session start
+     * @return key
+     */
+    static unsigned long long key( unsigned long srcid, unsigned int time ) noexcept {
+        return ( static_cast<unsigned long long>( srcid ) << 32u ) | time;
+    }
+};
+}  // namespace VieVS
+
+#endif  // POINTINGCACHE_H
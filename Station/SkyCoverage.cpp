@@ -37,18 +37,32 @@ SkyCoverage::SkyCoverage( string name, double maxInfluenceTime, double maxInflue
       maxInfluenceTime{ maxInfluenceTime },
       maxInfluenceDistance{ maxInfluenceDistance * deg2rad },
       interpolationTime{ interpolationTime },
-      interpolationDistance{ interpolationDistance } {}
+      interpolationDistance{ interpolationDistance } {
+    rebuildIndex();
+}
 
 
 double SkyCoverage::calcScore( const PointingVector &pv ) const {
     double score = 1;
-    for ( const auto &pv_old : pointingVectors_ ) {
-        if ( pv_old.getTime() > pv.getTime() ) {
-            continue;
-        }
-        double thisScore = scorePerPointingVector( pv, pv_old );
-        if ( thisScore < score ) {
-            score = thisScore;
+
+    // only observations within maximum influence time and neighbouring elevation bands can influence the score
+    // (second neighbour is included to be safe against rounding at band borders)
+    unsigned int time = pv.getTime();
+    auto window = static_cast<unsigned int>( max( 0.0, min( maxInfluenceTime, static_cast<double>( time ) ) ) );
+    unsigned int startTime = time - window;
+
+    unsigned long band = bandIndex( pv.getEl() );
+    unsigned long firstBand = band > 1 ? band - 2 : 0;
+    unsigned long lastBand = min( band + 2, static_cast<unsigned long>( bands_.size() - 1 ) );
+    for ( unsigned long i = firstBand; i <= lastBand; ++i ) {
+        const auto &thisBand = bands_[i];
+        auto it = lower_bound( thisBand.begin(), thisBand.end(), startTime,
+                               []( const IndexEntry &entry, unsigned int t ) { return entry.time < t; } );
+        for ( ; it != thisBand.end() && it->time <= time; ++it ) {
+            double thisScore = scorePerPointingVector( pv, pointingVectors_[it->idx] );
+            if ( thisScore < score ) {
+                score = thisScore;
+            }
         }
     }
 
@@ -56,7 +70,41 @@ double SkyCoverage::calcScore( const PointingVector &pv ) const {
 }
 
 
-void SkyCoverage::update( const PointingVector &pv ) noexcept { pointingVectors_.push_back( pv ); }
+void SkyCoverage::update( const PointingVector &pv ) noexcept {
+    pointingVectors_.push_back( pv );
+    addToIndex( pointingVectors_.size() - 1 );
+}
+
+
+unsigned long SkyCoverage::bandIndex( double el ) const noexcept {
+    double band = floor( ( el + halfpi ) / bandWidth_ );
+    if ( band <= 0 ) {
+        return 0;
+    }
+    return min( static_cast<unsigned long>( band ), static_cast<unsigned long>( bands_.size() - 1 ) );
+}
+
+
+void SkyCoverage::addToIndex( unsigned long idx ) noexcept {
+    const PointingVector &pv = pointingVectors_[idx];
+    auto &thisBand = bands_[bandIndex( pv.getEl() )];
+    IndexEntry entry{ pv.getTime(), idx };
+
+    // observations are usually added in chronological order
+    auto it = upper_bound( thisBand.begin(), thisBand.end(), entry.time,
+                           []( unsigned int t, const IndexEntry &other ) { return t < other.time; } );
+    thisBand.insert( it, entry );
+}
+
+
+void SkyCoverage::rebuildIndex() noexcept {
+    bandWidth_ = maxInfluenceDistance > 0 ? min( maxInfluenceDistance, pi ) : pi;
+    auto nBands = static_cast<unsigned long>( ceil( pi / bandWidth_ ) ) + 1;
+    bands_ = vector<vector<IndexEntry>>( nBands );
+    for ( unsigned long i = 0; i < pointingVectors_.size(); ++i ) {
+        addToIndex( i );
+    }
+}
 
 
 double SkyCoverage::scorePerPointingVector( const PointingVector &pv_new,
@@ -116,13 +164,17 @@ double SkyCoverage::scorePerPointingVector( const PointingVector &pv_new,
 }
 
 
-void SkyCoverage::clearObservations() { pointingVectors_.clear(); }
+void SkyCoverage::clearObservations() {
+    pointingVectors_.clear();
+    rebuildIndex();
+}
 
 
 void SkyCoverage::calculateSkyCoverageScores() {
     std::sort(
         pointingVectors_.begin(), pointingVectors_.end(),
         []( const PointingVector &left, const PointingVector &right ) { return left.getTime() < right.getTime(); } );
+    rebuildIndex();
 
     a13m8_ = skyCoverageScore_13( 480 );
     a25m8_ = skyCoverageScore_25( 480 );
@@ -139,6 +191,31 @@ void SkyCoverage::calculateSkyCoverageScores() {
 }
 
 
+double SkyCoverage::partialSkyCoverageScore( unsigned int time ) const {
+    unsigned int nIntervals = ( time + 3599 ) / 3600;
+    if ( nIntervals == 0 ) {
+        return 0;
+    }
+
+    vector<set<int>> areas1( nIntervals );
+    vector<set<int>> areas2( nIntervals );
+    for ( const auto &pv : pointingVectors_ ) {
+        if ( pv.getTime() < time ) {
+            areas1[pv.getTime() / 3600].insert( areaIndex13_v1( pv ) );
+            areas2[pv.getTime() / 3600].insert( areaIndex13_v2( pv ) );
+        }
+    }
+
+    double total_score = 0;
+    for ( unsigned int i = 0; i < nIntervals; ++i ) {
+        double score = static_cast<double>( areas1[i].size() ) / 2.0 +
+                       static_cast<double>( areas2[i].size() ) / 2.0;  // average of both distributions
+        total_score += score / 13.0;                                // normalize score
+    }
+    return total_score / nIntervals;
+}
+
+
 double SkyCoverage::skyCoverageScore_13( unsigned int deltaTime ) const {
     double total_score = 0;
 
@@ -28,6 +28,7 @@
 #define SKYCOVERAGE_H
 
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <limits>
@@ -156,6 +157,19 @@ class SkyCoverage : public VieVS_NamedObject {
     void calculateSkyCoverageScores();
 
 
+    /**
+     * @brief sky coverage score of the first part of the session
+     * @author Matthias Schartner
+     *
+     * with 13 areas over 60 minutes, only pointing vectors before given time are considered.
+     * Can be used during scan selection (pointing vectors need not be sorted).
+     *
+     * @param time end time in seconds since session start
+     * @return sky coverage score
+     */
+    double partialSkyCoverageScore( unsigned int time ) const;
+
+
     /**
      * @brief get total sky coverage score
      * @author Matthias Schartner
@@ -261,7 +275,10 @@ class SkyCoverage : public VieVS_NamedObject {
      */
     double getSkyCoverageScore_a37m60() const { return a37m60_; }
 
-    void setInfluenceDistance( double dist ) { maxInfluenceDistance = dist * deg2rad; }
+    void setInfluenceDistance( double dist ) {
+        maxInfluenceDistance = dist * deg2rad;
+        rebuildIndex();
+    }
 
     void setInfluenceTime( double time ) { maxInfluenceTime = time; }
 
@@ -288,6 +305,18 @@ class SkyCoverage : public VieVS_NamedObject {
 
 
     std::vector<PointingVector> pointingVectors_;  ///< all pointing vectors
+
+    /**
+     * @brief entry of elevation band index
+     * @author Matthias Schartner
+     */
+    struct IndexEntry {
+        unsigned int time;  ///< observation time
+        unsigned long idx;  ///< index in pointingVectors_
+    };
+
+    double bandWidth_ = pi;                       ///< width of elevation bands in radians
+    std::vector<std::vector<IndexEntry>> bands_;  ///< pointing vectors per elevation band (sorted by time)
     double a13m8_{ 0 };                            ///< sky coverage score with 13 areas over 15 minutes
     double a25m8_{ 0 };                            ///< sky coverage score with 25 areas over 15 minutes
     double a37m8_{ 0 };                            ///< sky coverage score with 37 areas over 15 minutes
@@ -351,6 +380,34 @@ class SkyCoverage : public VieVS_NamedObject {
     static int areaIndex13_v1( const PointingVector &pv ) noexcept;
 
 
+    /**
+     * @brief elevation band of an elevation angle
+     * @author Matthias Schartner
+     *
+     * @param el elevation in radians
+     * @return band index
+     */
+    unsigned long bandIndex( double el ) const noexcept;
+
+
+    /**
+     * @brief add pointing vector to elevation band index
+     * @author Matthias Schartner
+     *
+     * @param idx index in pointingVectors_
+     */
+    void addToIndex( unsigned long idx ) noexcept;
+
+
+    /**
+     * @brief recreate elevation band index
+     * @author Matthias Schartner
+     *
+     * bands are as wide as the maximum influence distance
+     */
+    void rebuildIndex() noexcept;
+
+
     /**
      * @brief area index of observation
      * @author Matthias Schartner
@@ -25,6 +25,8 @@
 
 #include "Station.h"
 
+#include <cstring>
+
 #include "../Misc/LookupTable.h"
 
 
@@ -75,9 +77,9 @@ Station::Station( std::string sta_name, std::string tlc, std::shared_ptr<Abstrac
       position_{ move( sta_position ) },
       equip_{ move( sta_equip ) },
       mask_{ move( sta_mask ) },
+      azelPrecalc_{ PointingCache( nSources ) },
       currentPositionVector_{ PointingVector( nextId - 1, numeric_limits<unsigned long>::max() ) },
-      parameters_{ Parameters( "empty" ) },
-      azelPrecalc_{ vector<vector<PointingVector>>( nSources ) } {
+      parameters_{ Parameters( "empty" ) } {
     parameters_.firstScan = true;
 }
 
@@ -108,98 +110,60 @@ bool Station::isVisible( const PointingVector &p, double minElevationSource ) co
 
 
 void Station::calcAzEl_simple( std::shared_ptr<const AbstractSource> source, PointingVector &p ) const noexcept {
-    auto &precalc = azelPrecalc_[source->getId()];
+    if ( !azelPrecalc_.interpolate( source->getId(), p ) ) {
+        computeAzEl_rigorous( source, p, AstronomicalParameters::getEarthOrientation( p.getTime() ) );
+    }
+}
 
-    unsigned int time = p.getTime();
 
-    auto it_n = precalc.begin();
-    // iterate over each precalculated value
-    for ( it_n; it_n < precalc.end(); ++it_n ) {
-        if ( it_n->getTime() >= time ) {
-            break;
-        }
-    }
+void Station::calcAzEl_rigorous( const shared_ptr<const AbstractSource> &source, PointingVector &p ) noexcept {
     // check if a precalculated value matches time exactly
-    if ( it_n->getTime() == time ) {
-        p.setAz( it_n->getAz() );
-        p.setEl( it_n->getEl() );
-        p.setHa( it_n->getHa() );
-        p.setDc( it_n->getDc() );
+    if ( p.getSrcid() < azelPrecalc_.getNSources() && azelPrecalc_.lookupExact( source->getId(), p ) ) {
         return;
     }
+    calcAzEl_rigorous( source, p, AstronomicalParameters::getEarthOrientation( p.getTime() ) );
+}
 
-    auto it_p = std::prev( it_n );
-
-    int dt = it_n->getTime() - it_p->getTime();
-    double factor = static_cast<double>( time - it_p->getTime() ) / static_cast<double>( dt );
 
-    double az1 = it_p->getAz();
-    double az2 = it_n->getAz();
-    double az;
-    if ( abs( az1 - az2 ) > halfpi ) {
-        if ( az1 < az2 ) {
-            az1 += twopi;
-        } else {
-            az2 += twopi;
-        }
-        az = it_p->getAz() + factor * ( it_n->getAz() - it_p->getAz() );
-        while ( az > twopi ) {
-            az -= twopi;
-        }
-    } else {
-        az = it_p->getAz() + factor * ( it_n->getAz() - it_p->getAz() );
+void Station::calcAzEl_rigorous( const shared_ptr<const AbstractSource> &source, PointingVector &p,
+                                 const AstronomicalParameters::EarthOrientation &eo ) noexcept {
+    computeAzEl_rigorous( source, p, eo );
+    if ( p.getSrcid() < azelPrecalc_.getNSources() ) {
+        azelPrecalc_.addRigorous( source->getId(), p );
     }
+}
 
-    double el = it_p->getEl() + factor * ( it_n->getEl() - it_p->getEl() );
 
-    double ha1 = it_p->getHa();
-    double ha2 = it_n->getHa();
-    double ha;
-    if ( abs( ha1 - ha2 ) > halfpi ) {
-        if ( ha1 < ha2 ) {
-            ha1 += twopi;
-        } else {
-            ha2 += twopi;
-        }
-        ha = it_p->getHa() + factor * ( it_n->getHa() - it_p->getHa() );
-        while ( ha > twopi ) {
-            ha -= twopi;
+void Station::precalcAzEl( const vector<shared_ptr<const AbstractSource>> &sources, unsigned int step,
+                           unsigned int duration ) noexcept {
+    unsigned int nEpochs = ( duration + step - 1 ) / step;
+    for ( const auto &source : sources ) {
+        if ( source->getId() < azelPrecalc_.getNSources() ) {
+            azelPrecalc_.initializeGrid( source->getId(), step, nEpochs );
         }
-    } else {
-        ha = it_p->getHa() + factor * ( it_n->getHa() - it_p->getHa() );
     }
 
-    p.setAz( az );
-    p.setEl( el );
-    p.setHa( ha );
-    p.setDc( it_n->getDc() );
+    // epoch by epoch so that all sources share the same earth orientation
+    for ( unsigned int i = 0; i < nEpochs; ++i ) {
+        const auto &eo = AstronomicalParameters::getEarthOrientation( i * step );
+        for ( const auto &source : sources ) {
+            unsigned long srcid = source->getId();
+            if ( srcid >= azelPrecalc_.getNSources() ) {
+                continue;
+            }
+            PointingVector npv( getId(), srcid );
+            npv.setTime( i * step );
+            computeAzEl_rigorous( source, npv, eo );
+            azelPrecalc_.setGridValue( srcid, i, npv );
+        }
+    }
 }
 
 
-void Station::calcAzEl_rigorous( const shared_ptr<const AbstractSource> &source, PointingVector &p ) noexcept {
+void Station::computeAzEl_rigorous( const shared_ptr<const AbstractSource> &source, PointingVector &p,
+                                    const AstronomicalParameters::EarthOrientation &eo ) const noexcept {
     unsigned int time = p.getTime();
 
-    if ( p.getSrcid() < azelPrecalc_.size() ) {
-        auto &precalc = azelPrecalc_[source->getId()];
-
-        auto it = precalc.begin();
-        // iterate over each precalculated value
-        for ( ; it < precalc.end(); ++it ) {
-            if ( it->getTime() >= time ) {
-                break;
-            }
-        }
-
-        // check if a precalculated value matches time exactly
-        if ( it != precalc.end() && it->getTime() == time ) {
-            p.setAz( it->getAz() );
-            p.setEl( it->getEl() );
-            p.setHa( it->getHa() );
-            p.setDc( it->getDc() );
-            return;
-        }
-    }
-
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logTrace )
         BOOST_LOG_TRIVIAL( trace ) << "station " << this->getName() << " calculate azimuth and elevation to source "
@@ -208,54 +172,9 @@ void Station::calcAzEl_rigorous( const shared_ptr<const AbstractSource> &source,
 
     double omega = 7.2921151467069805e-05;  // 1.00273781191135448*D2PI/86400;
 
-    //  TIME
-    double date1 = 2400000.5;
-    double mjd = TimeSystem::mjdStart + static_cast<double>( time ) / 86400.0;
-
-    // Earth Rotation
-    double ERA = iauEra00( date1, mjd );
-
-    // precession nutation
-    double C[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
-
-    // TODO: change to helper functions
-    unsigned int nut_precalc_idx = 0;
-    while ( AstronomicalParameters::earth_nutTime[nut_precalc_idx + 1] < time ) {
-        ++nut_precalc_idx;
-    }
-    unsigned int delta = AstronomicalParameters::earth_nutTime[1] - AstronomicalParameters::earth_nutTime[0];
-
-    unsigned int deltaTime = time - AstronomicalParameters::earth_nutTime[nut_precalc_idx];
-
-    double x = AstronomicalParameters::earth_nutX[nut_precalc_idx] +
-               ( AstronomicalParameters::earth_nutX[nut_precalc_idx + 1] -
-                 AstronomicalParameters::earth_nutX[nut_precalc_idx] ) /
-                   delta * deltaTime;
-    double y = AstronomicalParameters::earth_nutY[nut_precalc_idx] +
-               ( AstronomicalParameters::earth_nutY[nut_precalc_idx + 1] -
-                 AstronomicalParameters::earth_nutY[nut_precalc_idx] ) /
-                   delta * deltaTime;
-    double s = AstronomicalParameters::earth_nutS[nut_precalc_idx] +
-               ( AstronomicalParameters::earth_nutS[nut_precalc_idx + 1] -
-                 AstronomicalParameters::earth_nutS[nut_precalc_idx] ) /
-                   delta * deltaTime;
-
-    iauC2ixys( x, y, s, C );
-
-    //  Polar Motion
-    double W[3][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 } };
-    //  GCRS to ITRS
-    double c2t[3][3];
-    iauC2tcio( C, ERA, W, c2t );
-    double t2c[3][3] = {};
-    iauTr( c2t, t2c );
-
     //  Transformation
     double v1[3] = { -omega * position_->getX(), omega * position_->getY(), 0 };
 
-    double v1R[3] = {};
-    iauRxp( t2c, v1, v1R );
-
     double k1a[3] = {};
     double k1a_t1[3];
 
@@ -280,6 +199,8 @@ void Station::calcAzEl_rigorous( const shared_ptr<const AbstractSource> &source,
     iauPpp( k1a_temp, k1a_t2, k1a );
 
     //  source in TRS
+    double c2t[3][3];
+    memcpy( c2t, eo.c2t, sizeof( c2t ) );
     double rq[3] = {};
     iauRxp( c2t, k1a, rq );
 
@@ -307,7 +228,7 @@ void Station::calcAzEl_rigorous( const shared_ptr<const AbstractSource> &source,
     p.setEl( el );
 
     // only for hadc antennas
-    double gmst = TimeSystem::mjd2gmst( mjd );
+    double gmst = eo.gmst;
     //    auto srcRaDe = source->getRaDe( time, position_ );
 
     double ha = gmst + position_->getLon() - srcRaDe.first;
@@ -322,11 +243,6 @@ void Station::calcAzEl_rigorous( const shared_ptr<const AbstractSource> &source,
     // end of hadc part
 
     p.setTime( time );
-
-    if ( p.getSrcid() < azelPrecalc_.size() ) {
-        auto &precalc = azelPrecalc_[source->getId()];
-        precalc.push_back( p );
-    }
 }
 
 
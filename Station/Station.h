@@ -46,6 +46,7 @@
 #include "CableWrap/AbstractCableWrap.h"
 #include "Equip/AbstractEquipment.h"
 #include "HorizonMask/AbstractHorizonMask.h"
+#include "PointingCache.h"
 #include "Position.h"
 #pragma push_macro("DAYSEC")
 #pragma push_macro("DC")
@@ -464,6 +465,27 @@ class Station : public VieVS_NamedObject {
     void calcAzEl_simple( std::shared_ptr<const AbstractSource> source, PointingVector &p ) const noexcept;
 
 
+    /**
+     * @brief precalculate azimuth and elevation lookup table with rigorous model
+     * @author Matthias Schartner
+     *
+     * @param sources observed sources
+     * @param step time step in seconds
+     * @param duration covered time span in seconds since session start
+     */
+    void precalcAzEl( const std::vector<std::shared_ptr<const AbstractSource>> &sources, unsigned int step,
+                      unsigned int duration ) noexcept;
+
+
+    /**
+     * @brief lock or unlock the rigorous side table of the azimuth elevation lookup table
+     * @author Matthias Schartner
+     *
+     * @param flag true if calcAzEl_rigorous() must not change this station (e.g. concurrent calls from several threads)
+     */
+    void setAzElCacheReadOnly( bool flag ) noexcept { azelPrecalc_.setReadOnly( flag ); }
+
+
     /**
      * @brief change current pointing vector
      * @author Matthias Schartner
@@ -728,8 +750,8 @@ class Station : public VieVS_NamedObject {
     std::string recording_system_id_ = "unknown";    ///< recoring system id (e.g.: "Ke")
     std::string occupation_code_ = "unknown";        ///< occupation code (e.g.: "72425901")
 
-    Statistics statistics_;                                 ///< station statistics
-    std::vector<std::vector<PointingVector>> azelPrecalc_;  ///< pre calculated azimuth elevation lookup table
+    Statistics statistics_;      ///< station statistics
+    PointingCache azelPrecalc_;  ///< pre calculated azimuth elevation lookup table
 
     Parameters parameters_;                 ///< station parameters
     PointingVector currentPositionVector_;  ///< current pointing vector
@@ -738,6 +760,32 @@ class Station : public VieVS_NamedObject {
     int nTotalScans_{ 0 };                  ///< number of total scans
     int nObs_{ 0 };                         ///< number of observed baselines
     unsigned int totalObsTime_{ 0 };        ///< total observing time in seconds
+
+
+    /**
+     * @brief calculation of azimuth, elevation, hour angle and declination with rigorouse model
+     * @author Matthias Schartner
+     *
+     * result is stored in lookup table
+     *
+     * @param source observed source
+     * @param p pointing vector
+     * @param eo earth orientation at time of pointing vector
+     */
+    void calcAzEl_rigorous( const std::shared_ptr<const AbstractSource> &source, PointingVector &p,
+                            const AstronomicalParameters::EarthOrientation &eo ) noexcept;
+
+
+    /**
+     * @brief calculation of azimuth, elevation, hour angle and declination with rigorouse model without lookup
+     * @author Matthias Schartner
+     *
+     * @param source observed source
+     * @param p pointing vector
+     * @param eo earth orientation at time of pointing vector
+     */
+    void computeAzEl_rigorous( const std::shared_ptr<const AbstractSource> &source, PointingVector &p,
+                               const AstronomicalParameters::EarthOrientation &eo ) const noexcept;
 };
 }  // namespace VieVS
 #endif /* STATION_H */
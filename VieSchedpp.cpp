@@ -74,12 +74,16 @@ void VieSchedpp::run() {
     cout << "[info] writing initializer output to: initializer.txt";
 #endif
 
+    // worker processes share the output directory with the coordinator - only the coordinator writes these files
     ofstream of;
-    if ( xml_.get( "VieSchedpp.output.initializer_log", true ) ) {
+    if ( worker_ == nullptr && xml_.get( "VieSchedpp.output.initializer_log", true ) ) {
         of.open( path_ + sessionName_ + "_initializer.txt" );
     }
 
-    ofstream statisticsOf( path_ + "statistics.csv" );
+    ofstream statisticsOf;
+    if ( worker_ == nullptr ) {
+        statisticsOf.open( path_ + "statistics.csv" );
+    }
 
     LookupTable::initialize();
     // initialize skd catalogs and lookup table
@@ -164,7 +168,9 @@ void VieSchedpp::run() {
     }
     of.close();
 
-    init.statisticsLogHeader( statisticsOf, multiSchedParameters_ );
+    ostringstream statisticsHeader;
+    init.statisticsLogHeader( statisticsHeader, multiSchedParameters_ );
+    statistics_.setHeader( statisticsHeader.str() );
     int counter = 0;
 
 // check if openmp is available
@@ -202,6 +208,10 @@ void VieSchedpp::run() {
                 break;
         }
 
+        if ( costAwareScheduling_ ) {
+            jobScheduling = "cost aware tasks";
+        }
+
 #ifdef VIESCHEDPP_LOG
         BOOST_LOG_TRIVIAL( info ) << boost::format( "OpenMP: job scheduling %s chunk size %d" ) % jobScheduling %
                                          chunkSize;
@@ -210,6 +220,19 @@ void VieSchedpp::run() {
         cout << boost::format( "[info] OpenMP: job scheduling %s chunk size %d\n" ) % jobScheduling % chunkSize;
         cout << boost::format( "number of threads %d\n" ) % omp_get_num_threads();
 #endif
+    } else {
+        // single schedule: update the best scan candidates in parallel
+        Subcon::speculativeCandidates = xml_.get<unsigned int>( "VieSchedpp.multiCore.speculativeCandidates", 0 );
+        if ( Subcon::speculativeCandidates > 1 ) {
+            multiCoreSetup();
+#ifdef VIESCHEDPP_LOG
+            BOOST_LOG_TRIVIAL( info ) << boost::format( "using OpenMP to update %d scan candidates in parallel" ) %
+                                             Subcon::speculativeCandidates;
+#else
+            cout << boost::format( "[info] using OpenMP to update %d scan candidates in parallel\n" ) %
+                        Subcon::speculativeCandidates;
+#endif
+        }
     }
 #else
     if ( nsched > 1 ) {
@@ -222,6 +245,34 @@ void VieSchedpp::run() {
     }
 #endif
 
+    // distribute versions to worker processes
+    unique_ptr<Coordinator> coordinator;
+    if ( flag_multiSched && worker_ == nullptr &&
+         xml_.get_child_optional( "VieSchedpp.multiCore.distributed" ).is_initialized() ) {
+        auto port = xml_.get<unsigned short>( "VieSchedpp.multiCore.distributed.port", 0 );
+        int localWorkers = xml_.get( "VieSchedpp.multiCore.distributed.localWorkers", 0 );
+        int timeout = xml_.get( "VieSchedpp.multiCore.distributed.timeout", 3600 );
+        bool remoteWorkers = xml_.get( "VieSchedpp.multiCore.distributed.remoteWorkers", false );
+        auto token = xml_.get( "VieSchedpp.multiCore.distributed.token", string() );
+        coordinator = make_unique<Coordinator>( filesystem::absolute( inputFile_ ).string(), port, timeout,
+                                                remoteWorkers, token );
+        coordinator->startLocalWorkers( executable_, localWorkers );
+
+        // a configured token is not written to the log file
+        string host = remoteWorkers ? "<host>" : "127.0.0.1";
+        string shownToken = token.empty() ? coordinator->getToken() : "<token>";
+#ifdef VIESCHEDPP_LOG
+        BOOST_LOG_TRIVIAL( info ) << boost::format( "distributing multi scheduling to %d local worker(s); start "
+                                                    "additional workers with: VIESCHEDPP_WORKER_TOKEN=%s VieSchedpp "
+                                                    "--worker %s:%d" ) %
+                                         localWorkers % shownToken % host % coordinator->getPort();
+#else
+        cout << boost::format( "[info] distributing multi scheduling to %d local worker(s); start additional workers "
+                               "with: VIESCHEDPP_WORKER_TOKEN=%s VieSchedpp --worker %s:%d\n" ) %
+                    localWorkers % shownToken % host % coordinator->getPort();
+#endif
+    }
+
     int versionOffset = xml_.get( "VieSchedpp.general.versionOffset", 0 );
     int startCounter = 0;
 
@@ -234,105 +285,451 @@ void VieSchedpp::run() {
         nsched_total += ( n_it - 1 ) * n;
     }
 
+    // checkpoint/resume: the checkpoint is written at the start of every generation, versions which finish later
+    // are appended to a journal. A restarted run skips all finished versions and continues the evolution.
+    bool checkpointing = flag_multiSched && worker_ == nullptr && xml_.get( "VieSchedpp.multisched.checkpoint", false );
+    string checkpointFile = path_ + sessionName_ + "_checkpoint.json";
+    string journalFile = path_ + sessionName_ + "_checkpoint_journal.txt";
+    int firstGeneration = 0;
+    if ( checkpointing ) {
+        readCheckpoint( checkpointFile, journalFile, firstGeneration, startCounter, nsched );
+    }
+    ofstream journal;
+    set<int> finishedVersions;
+
     unsigned int population_size = 32;
     double keep_best = 0.1;
     double keep_random = 0.025;
     double mutation_factor = 0.5;
 
-    for ( int i_generation = 0; i_generation < maxGeneration; ++i_generation ) {
-        // main scheduling code start
-#ifdef _OPENMP
-#pragma omp parallel for schedule( runtime )
-#endif
-        // create all required schedules
-        for ( int i = 0; i < nsched; ++i ) {
-            // create initializer and set static parameters for each thread
-            Initializer newInit( init );
-            newInit.initializeWeightFactors();
-
-            // get version number
-            int version = startCounter + versionOffset;
-            if ( flag_multiSched ) {
-                version += i + 1;
-                // change version number in case you only process one solution
-                auto o_version = xml_.get_optional<int>( "VieSchedpp.multisched.version" );
-                if ( o_version.is_initialized() ) {
-                    version = *o_version;
-                }
+    // session parameters are stored per thread - every schedule starts from the values of this thread
+    SchedulingContext context = SchedulingContext::capture();
+
+    // multi scheduling parameters of i-th schedule of current generation
+    auto multiSchedParametersOf = [&]( int i ) -> const MultiScheduling::Parameters & {
+        if ( xml_.get_optional<int>( "VieSchedpp.multisched.version" ).is_initialized() ) {
+            return multiSchedParameters_[0];
+        }
+        return multiSchedParameters_[startCounter + i];
+    };
+
+    // version number of i-th schedule of current generation
+    auto versionOf = [&]( int i ) {
+        int version = startCounter + versionOffset;
+        if ( flag_multiSched ) {
+            version += i + 1;
+            // change version number in case you only process one solution
+            auto o_version = xml_.get_optional<int>( "VieSchedpp.multisched.version" );
+            if ( o_version.is_initialized() ) {
+                version = *o_version;
             }
+        }
+        return version;
+    };
+
+    // early termination: versions which are clearly dominated by the previous generation (most observations at the
+    // same checkpoint) in number of observations, sky coverage and number of observed sources are aborted. The
+    // reference does not change during a generation, so aborted versions do not depend on thread count or on the
+    // order in which versions are processed. Versions of the first generation and of the first generation after
+    // resuming from a checkpoint file are never aborted (no reference available).
+    const auto &o_earlyTermination = xml_.get_child_optional( "VieSchedpp.multisched.genetic.early_termination" );
+    bool earlyTermination = maxGeneration > 1 && o_earlyTermination.is_initialized();
+    unsigned int checkpointInterval = 3600;
+    double tolerance = 0.2;
+    if ( earlyTermination ) {
+        checkpointInterval = o_earlyTermination->get<unsigned int>( "interval", 3600 );
+        tolerance = o_earlyTermination->get( "tolerance_percent", 20.0 ) / 100;
+    }
+    map<unsigned int, Scheduler::Checkpoint> referenceCheckpoint;  // best checkpoints of previous generation
+    map<unsigned int, Scheduler::Checkpoint> bestCheckpoint;       // best checkpoints of current generation
+    mutex checkpointMutex;
+
+    auto isPromising = [&]( const Scheduler::Checkpoint &checkpoint ) {
+        auto nSources = []( const Scheduler::Checkpoint &c ) {
+            return count_if( c.nScansPerSource.begin(), c.nScansPerSource.end(),
+                             []( unsigned int n ) { return n > 0; } );
+        };
+
+        lock_guard<mutex> lock( checkpointMutex );
+        // ties are resolved by version number, so the result is independent of the processing order
+        auto it_best = bestCheckpoint.find( checkpoint.time );
+        if ( it_best == bestCheckpoint.end() ) {
+            bestCheckpoint[checkpoint.time] = checkpoint;
+        } else if ( checkpoint.nObservations > it_best->second.nObservations ||
+                    ( checkpoint.nObservations == it_best->second.nObservations &&
+                      checkpoint.version < it_best->second.version ) ) {
+            it_best->second = checkpoint;
+        }
+
+        auto it = referenceCheckpoint.find( checkpoint.time );
+        if ( it == referenceCheckpoint.end() ) {
+            return true;
+        }
+        const Scheduler::Checkpoint &best = it->second;
+
+        // first checkpoint is not used (too early to judge)
+        double f = 1 - tolerance;
+        bool dominated = checkpoint.time >= 2 * checkpointInterval &&
+                         checkpoint.nObservations < f * best.nObservations &&
+                         checkpoint.skyCoverage < f * best.skyCoverage && nSources( checkpoint ) < f * nSources( best );
+        if ( dominated ) {
+#ifdef VIESCHEDPP_LOG
+            BOOST_LOG_TRIVIAL( info ) << boost::format( "%sdominated by version %d at %s (#obs %d vs %d) -> "
+                                                        "aborted" ) %
+                                             util::version2prefix( checkpoint.version ) % best.version %
+                                             TimeSystem::time2string( checkpoint.time ) % checkpoint.nObservations %
+                                             best.nObservations;
+#else
+            cout << boost::format( "[info] %sdominated by version %d at %s (#obs %d vs %d) -> aborted\n" ) %
+                        util::version2prefix( checkpoint.version ) % best.version %
+                        TimeSystem::time2string( checkpoint.time ) % checkpoint.nObservations % best.nObservations;
+#endif
+        }
+        return !dominated;
+    };
+
+    // versions without result (crashed or aborted) get score 0 and are not used as parents
+    auto completeScores = [&]( map<int, double> &scores ) {
+        for ( unsigned long i = 0; i < multiSchedParameters_.size(); ++i ) {
+            scores.emplace( versionOffset + static_cast<int>( i ) + 1, 0.0 );
+        }
+    };
 
-            // get file name
-            string fname = sessionName_;
+    // create i-th schedule of current generation (nullptr if it crashed or was aborted)
+    auto createSchedule = [&]( int i ) -> shared_ptr<Scheduler> {
+        // create initializer (session parameters of the calling thread are set by scheduleStage)
+        Initializer newInit( init );
+        newInit.initializeWeightFactors();
 
-            // increment counter of multi scheduling version
+        // get version number
+        int version = versionOf( i );
+
+        // get file name
+        string fname = sessionName_;
+
+        // increment counter of multi scheduling version
+        int thisCounter;
 #ifdef _OPENMP
-#pragma omp atomic
+#pragma omp atomic capture
 #endif
-            ++counter;
-            if ( version > 0 ) {
-                fname.append( ( boost::format( "_v%03d" ) % ( version ) ).str() );
-            }
-            // if you have multi schedule append version number to file name and add parameters
-            if ( flag_multiSched ) {
+        thisCounter = ++counter;
+        if ( version > 0 ) {
+            fname.append( ( boost::format( "_v%03d" ) % ( version ) ).str() );
+        }
+        // if you have multi schedule append version number to file name and add parameters
+        if ( flag_multiSched ) {
 #ifdef VIESCHEDPP_LOG
-                BOOST_LOG_TRIVIAL( info ) << boost::format( "creating multi scheduling version %d (%d of %d)" ) %
-                                                 version % counter % nsched_total;
+            BOOST_LOG_TRIVIAL( info ) << boost::format( "creating multi scheduling version %d (%d of %d)" ) % version %
+                                             thisCounter % nsched_total;
 #else
-                cout << boost::format( "[info] creating multi scheduling version %d (%d of %d)\n" ) % version %
-                            counter % nsched;
+            cout << boost::format( "[info] creating multi scheduling version %d (%d of %d)\n" ) % version %
+                        thisCounter % nsched;
 #endif
-                if ( xml_.get_optional<int>( "VieSchedpp.multisched.version" ).is_initialized() ) {
-                    newInit.applyMultiSchedParameters( multiSchedParameters_[0], version );
-                } else {
-                    newInit.applyMultiSchedParameters( multiSchedParameters_[startCounter + i], version );
-                }
+            newInit.applyMultiSchedParameters( multiSchedParametersOf( i ), version );
+        }
+
+        try {
+            auto scheduler = make_shared<Scheduler>( newInit, path_, fname );
+            if ( earlyTermination ) {
+                scheduler->setCheckpointCallback( checkpointInterval, isPromising );
             }
+            scheduler->start();
+            if ( scheduler->isAborted() ) {
+                return nullptr;
+            }
+            return scheduler;
+        } catch ( ... ) {
+#ifdef VIESCHEDPP_LOG
+            BOOST_LOG_TRIVIAL( fatal ) << util::version2prefix( version ) << "crashed";
+#else
+            cout << "[fatal] " << util::version2prefix( version ) << "crashed\n";
+#endif
+            return nullptr;
+        }
+    };
 
-            try {
-                VieVS::Scheduler scheduler = VieVS::Scheduler( newInit, path_, fname );
-                scheduler.start();
+    auto threadIndex = []() {
+#ifdef _OPENMP
+        return omp_get_thread_num();
+#else
+        return 0;
+#endif
+    };
 
-                // create output
-                VieVS::Output output(scheduler);
-                output.createAllOutputFiles( statisticsOf, skdCatalogs_ );
+    auto secondsSince = []( chrono::steady_clock::time_point t0 ) {
+        return chrono::duration<double>( chrono::steady_clock::now() - t0 ).count();
+    };
 
-                if ( auto ctree = xml_.get_child_optional( "VieSchedpp.simulator" ).is_initialized() ) {
+    // busy time per thread (used to report thread utilization)
+#ifdef _OPENMP
+    int nThreads = omp_get_max_threads();
+#else
+    int nThreads = 1;
+#endif
+    vector<double> busy( nThreads, 0.0 );
+
+    // finished schedules pass through output, simulation and compression stages. In the task based mode every stage
+    // is a separate task, so file writing and simulations overlap with scheduling of other versions.
+    bool pipeline = flag_multiSched && costAwareScheduling_ && worker_ == nullptr;
+    int pipelineDepth = xml_.get( "VieSchedpp.multiCore.pipelineDepth", 0 );
+    if ( pipelineDepth <= 0 ) {
+        pipelineDepth = nThreads;
+    }
+    int nPipeline = 0;
+
+    // schedule passing through the pipeline stages
+    struct PipelineItem {
+        int version;                      ///< version number
+        SchedulingContext context;        ///< session parameters after scheduling
+        std::string path;                 ///< output path
+        std::string name;                 ///< schedule name
+        shared_ptr<Scheduler> scheduler;  ///< finished schedule (released by output stage)
+        shared_ptr<Output> output;        ///< output (released by simulation stage)
+    };
+
+    // run next stage as separate task. If too many stages are pending it is executed immediately by this thread
+    // instead (backpressure), which limits the number of schedules held in memory.
+    auto runStage = [&]( const function<void()> &stage ) {
+        if ( !pipeline ) {
+            stage();
+            return;
+        }
+        int pending;
+#ifdef _OPENMP
+#pragma omp atomic capture
+#endif
+        pending = ++nPipeline;
+        if ( pending > pipelineDepth ) {
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            --nPipeline;
+            stage();
+            return;
+        }
+#ifdef _OPENMP
+#pragma omp task firstprivate( stage )
+#endif
+        {
+            stage();
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+            --nPipeline;
+        }
+    };
+
+    // last stage: compression
+    auto compressStage = [&]( const shared_ptr<PipelineItem> &item ) {
+#ifdef COMPRESSION_ENABLED
+        auto t0 = chrono::steady_clock::now();
+        if ( xml_.get( "VieSchedpp.output.compress", false ) ) {
+            util::compress( item->path, item->name );
+        }
+        busy[threadIndex()] += secondsSince( t0 );
+#endif
+
+#ifdef VIESCHEDPP_LOG
+        BOOST_LOG_TRIVIAL( info ) << util::version2prefix( item->version ) << "finished";
+#else
+        cout << util::version2prefix( item->version ) << "finished\n";
+#endif
+    };
+
+    // simulation and solving
+    auto simulationStage = [&]( const shared_ptr<PipelineItem> &item ) {
+        auto t0 = chrono::steady_clock::now();
+        SchedulingContext::Scope scope( item->context );
+        try {
 #ifdef SIMULATOR_MODE
-                    VieVS::Simulator simulator(output);
-                    simulator.start();
+            VieVS::Simulator simulator( *item->output );
+            item->output.reset();
+            simulator.start();
 
-                    VieVS::Solver solver(simulator);
-                    solver.start();
-                    solver.writeStatistics( statisticsOf );
+            VieVS::Solver solver( simulator );
+            solver.start();
+            solver.writeStatistics( statistics_ );
+#else
+#ifdef VIESCHEDPP_LOG
+            BOOST_LOG_TRIVIAL( warning ) << "VieSched++ was compiled without simulations. You cannot run "
+                                            "simulations. Recompile it without SIMULATOR_MODE.";
 #else
+            cout << "[warning] VieSched++ was compiled without simulations. You cannot run simulations. "
+                    "Recompile it without SIMULATOR_MODE.\n";
+#endif
+#endif
+        } catch ( ... ) {
 #ifdef VIESCHEDPP_LOG
-                    BOOST_LOG_TRIVIAL( warning ) << "VieSched++ was compiled without simulations. You cannot run "
-                                                    "simulations. Recompile it without SIMULATOR_MODE.";
+            BOOST_LOG_TRIVIAL( fatal ) << util::version2prefix( item->version ) << "crashed";
 #else
-                    cout << "[warning] VieSched++ was compiled without simulations. You cannot run simulations. "
-                            "Recompile it without SIMULATOR_MODE.\n";
+            cout << "[fatal] " << util::version2prefix( item->version ) << "crashed\n";
 #endif
+            busy[threadIndex()] += secondsSince( t0 );
+            return;
+        }
+        item->output.reset();
+        busy[threadIndex()] += secondsSince( t0 );
+
+        runStage( [=]() { compressStage( item ); } );
+    };
+
+    // output files
+    auto outputStage = [&]( const shared_ptr<PipelineItem> &item ) {
+        auto t0 = chrono::steady_clock::now();
+        SchedulingContext::Scope scope( item->context );
+        try {
+            item->output = make_shared<Output>( *item->scheduler );
+            item->scheduler.reset();
+            item->output->createAllOutputFiles( statistics_, skdCatalogs_ );
+        } catch ( ... ) {
+#ifdef VIESCHEDPP_LOG
+            BOOST_LOG_TRIVIAL( fatal ) << util::version2prefix( item->version ) << "crashed";
+#else
+            cout << "[fatal] " << util::version2prefix( item->version ) << "crashed\n";
 #endif
+            busy[threadIndex()] += secondsSince( t0 );
+            return;
+        }
+        busy[threadIndex()] += secondsSince( t0 );
+
+        if ( xml_.get_child_optional( "VieSchedpp.simulator" ).is_initialized() ) {
+            runStage( [=]() { simulationStage( item ); } );
+        } else {
+            item->output.reset();
+            runStage( [=]() { compressStage( item ); } );
+        }
+    };
+
+    // scheduling (first stage)
+    auto scheduleStage = [&]( int i ) {
+        if ( finishedVersions.find( versionOf( i ) ) != finishedVersions.end() ) {
+            return;
+        }
+        auto t0 = chrono::steady_clock::now();
+        SchedulingContext::Scope scope( context );
+        shared_ptr<Scheduler> scheduler = createSchedule( i );
+        if ( scheduler == nullptr ) {
+            busy[threadIndex()] += secondsSince( t0 );
+            return;
+        }
+        auto item = make_shared<PipelineItem>( PipelineItem{ versionOf( i ), SchedulingContext::capture(),
+                                                             scheduler->getPath(), scheduler->getName(),
+                                                             scheduler, nullptr } );
+        busy[threadIndex()] += secondsSince( t0 );
+
+        runStage( [=]() { outputStage( item ); } );
+    };
+
+    for ( int i_generation = firstGeneration; i_generation < maxGeneration; ++i_generation ) {
+        fill( busy.begin(), busy.end(), 0.0 );
+        referenceCheckpoint = move( bestCheckpoint );
+        bestCheckpoint.clear();
+        auto generationStart = chrono::steady_clock::now();
+
+        if ( checkpointing ) {
+            statistics_.setJournal( nullptr );
+            writeCheckpoint( checkpointFile, i_generation, startCounter, nsched );
+            journal.close();
+            journal.open( journalFile );
+            statistics_.setJournal( &journal );
+            for ( unsigned long r = 0; r < statistics_.getNRows(); ++r ) {
+                finishedVersions.insert( statistics_.getVersion( r ) );
+            }
+        }
+
+        // worker process: schedules are received from the coordinator one by one
+        if ( worker_ != nullptr ) {
+            startCounter = 0;
+            int index;
+            MultiScheduling::Parameters parameters;
+            while ( worker_->nextJob( index, parameters ) ) {
+                if ( static_cast<unsigned long>( index ) >= multiSchedParameters_.size() ) {
+                    multiSchedParameters_.resize( index + 1 );
                 }
-#ifdef COMPRESSION_ENABLED
-                if (xml_.get( "VieSchedpp.output.compress", false )) {
-                    util::compress(scheduler.getPath(), fname);
+                multiSchedParameters_[index] = move( parameters );
+
+                unsigned long nRows = statistics_.getNRows();
+                scheduleStage( index );
+                context.apply();
+                statistics_.merge();
+
+                vector<string> rows;
+                for ( unsigned long r = nRows; r < statistics_.getNRows(); ++r ) {
+                    rows.push_back( statistics_.getCsvRow( r ) );
                 }
+                worker_->finished( index, rows );
+            }
+            break;
+        }
+
+        // main scheduling code start
+        if ( coordinator != nullptr ) {
+            vector<Coordinator::Job> jobs;
+            for ( unsigned long i = 0; i < nsched; ++i ) {
+                if ( finishedVersions.find( versionOf( i ) ) == finishedVersions.end() ) {
+                    jobs.push_back( Coordinator::Job{ startCounter + static_cast<int>( i ), versionOf( i ),
+                                                      multiSchedParametersOf( i ) } );
+                }
+            }
+            coordinator->process( jobs, statistics_ );
+        } else if ( pipeline ) {
+            // most expensive schedules first, all stages are tasks which are picked up by any idle thread
+            vector<double> cost( nsched );
+            for ( unsigned long i = 0; i < nsched; ++i ) {
+                cost[i] = init.estimateCost( multiSchedParametersOf( i ) );
+            }
+            vector<int> order( nsched );
+            iota( order.begin(), order.end(), 0 );
+            stable_sort( order.begin(), order.end(), [&cost]( int a, int b ) { return cost[a] > cost[b]; } );
+
+#ifdef _OPENMP
+#pragma omp parallel
+#pragma omp single
 #endif
+            for ( int i : order ) {
+#ifdef _OPENMP
+#pragma omp task firstprivate( i )
+#endif
+                scheduleStage( i );
             }
-            catch(...) {
+        } else {
+#ifdef _OPENMP
+#pragma omp parallel for schedule( runtime )
+#endif
+            // create all required schedules
+            for ( int i = 0; i < nsched; ++i ) {
+                scheduleStage( i );
+            }
+        }
+        // this thread also processed schedules - restore its session parameters
+        context.apply();
+
+        statistics_.merge();
+        statistics_.writeCsv( statisticsOf );
+
+        if ( coordinator != nullptr ) {
 #ifdef VIESCHEDPP_LOG
-            BOOST_LOG_TRIVIAL(fatal) << util::version2prefix(version) << "crashed";
+            BOOST_LOG_TRIVIAL( info ) << boost::format( "generation %d: %d schedules in %.1f seconds on %d "
+                                                        "worker(s)" ) %
+                                             ( i_generation + 1 ) % nsched % secondsSince( generationStart ) %
+                                             coordinator->getNWorkers();
 #else
-            cout << "[fatal] "<<util::version2prefix(version) << "crashed\n";
+            cout << boost::format( "[info] generation %d: %d schedules in %.1f seconds on %d worker(s)\n" ) %
+                        ( i_generation + 1 ) % nsched % secondsSince( generationStart ) % coordinator->getNWorkers();
 #endif
-                continue;
+        } else if ( flag_multiSched ) {
+            double wallTime = secondsSince( generationStart );
+            double utilization = 1.0;
+            if ( wallTime > 0 ) {
+                utilization = accumulate( busy.begin(), busy.end(), 0.0 ) / ( wallTime * nThreads );
             }
-
 #ifdef VIESCHEDPP_LOG
-            BOOST_LOG_TRIVIAL(info) << util::version2prefix(version) << "finished";
+            BOOST_LOG_TRIVIAL( info ) << boost::format( "generation %d: %d schedules in %.1f seconds, thread "
+                                                        "utilization %.1f%%" ) %
+                                             ( i_generation + 1 ) % nsched % wallTime % ( 100 * utilization );
 #else
-            cout << util::version2prefix(version) << "finished\n";
+            cout << boost::format( "[info] generation %d: %d schedules in %.1f seconds, thread utilization %.1f%%\n" ) %
+                        ( i_generation + 1 ) % nsched % wallTime % ( 100 * utilization );
 #endif
         }
 
@@ -342,6 +739,7 @@ void VieSchedpp::run() {
             // generate new population of multi-scheduling parameters
             if ( nsched > 0 && i_generation + 1 < maxGeneration ) {
                 startCounter += nsched;
+                completeScores( scores );
                 vector<MultiScheduling::Parameters> newPara =
                     MultiScheduling::evolution_step( i_generation, multiSchedParameters_, scores, xml_ );
                 nsched = newPara.size();
@@ -351,9 +749,18 @@ void VieSchedpp::run() {
     }
 
     statisticsOf.close();
+    coordinator.reset();
+
+    // run finished - checkpoint is no longer needed
+    if ( checkpointing ) {
+        statistics_.setJournal( nullptr );
+        journal.close();
+        filesystem::remove( checkpointFile );
+        filesystem::remove( journalFile );
+    }
 
     // TODO: temporary output of evolution (maybe remove this in future)
-    if ( maxGeneration > 1 ) {
+    if ( worker_ == nullptr && maxGeneration > 1 ) {
         ofstream fid_genOutput( path_ + "evolution.csv" );
         int n_it = xml_.get( "VieSchedpp.multisched.genetic.evolutions", 2 );
         int n = xml_.get( "VieSchedpp.multisched.genetic.population_size", 32 );
@@ -368,6 +775,7 @@ void VieSchedpp::run() {
         multiSchedParameters_[0].statisticsHeaderOutput( fid_genOutput );
         fid_genOutput << endl;
         map<int, double> scores = summarizeSimulationResult( init.getNetwork(), init.getSourceList(), false );
+        completeScores( scores );
         vector<double> scores_vec;
         for ( const auto &any : scores ) {
             scores_vec.push_back( any.second );
@@ -392,6 +800,116 @@ void VieSchedpp::run() {
 }
 
 
+void VieSchedpp::writeCheckpoint( const std::string &file, int generation, int startCounter,
+                                  unsigned long nsched ) const {
+    boost::property_tree::ptree tree;
+    tree.add( "generation", generation );
+    tree.add( "startCounter", startCounter );
+    tree.add( "nsched", nsched );
+    tree.add( "seed", MultiScheduling::getSeed() );
+    tree.add( "header", boost::algorithm::join( statistics_.getHeader(), "," ) );
+
+    boost::property_tree::ptree parameters;
+    for ( const auto &any : multiSchedParameters_ ) {
+        parameters.push_back( make_pair( "", any.toPropertyTree() ) );
+    }
+    tree.add_child( "parameters", parameters );
+
+    boost::property_tree::ptree rows;
+    for ( unsigned long r = 0; r < statistics_.getNRows(); ++r ) {
+        boost::property_tree::ptree row;
+        row.add( "version", statistics_.getVersion( r ) );
+        row.add( "csv", statistics_.getCsvRow( r ) );
+        rows.push_back( make_pair( "", row ) );
+    }
+    tree.add_child( "statistics", rows );
+
+    string tmp = file + ".tmp";
+    {
+        ofstream of( tmp );
+        boost::property_tree::write_json( of, tree, false );
+    }
+    filesystem::rename( tmp, file );
+}
+
+
+bool VieSchedpp::readCheckpoint( const std::string &file, const std::string &journalFile, int &generation,
+                                 int &startCounter, unsigned long &nsched ) {
+    if ( !filesystem::exists( file ) ) {
+        return false;
+    }
+
+    boost::property_tree::ptree tree;
+    try {
+        ifstream is( file );
+        boost::property_tree::read_json( is, tree );
+    } catch ( const boost::property_tree::ptree_error &e ) {
+#ifdef VIESCHEDPP_LOG
+        BOOST_LOG_TRIVIAL( warning ) << "unable to read checkpoint " << file << " (" << e.what() << ") -> ignored";
+#else
+        cout << "[warning] unable to read checkpoint " << file << " (" << e.what() << ") -> ignored\n";
+#endif
+        return false;
+    }
+
+    // checkpoint of a different setup
+    if ( tree.get( "header", "" ) != boost::algorithm::join( statistics_.getHeader(), "," ) ) {
+#ifdef VIESCHEDPP_LOG
+        BOOST_LOG_TRIVIAL( warning ) << "checkpoint " << file << " does not match current setup -> ignored";
+#else
+        cout << "[warning] checkpoint " << file << " does not match current setup -> ignored\n";
+#endif
+        return false;
+    }
+
+    generation = tree.get<int>( "generation" );
+    startCounter = tree.get<int>( "startCounter" );
+    nsched = tree.get<unsigned long>( "nsched" );
+    MultiScheduling::setSeed( tree.get( "seed", MultiScheduling::getSeed() ) );
+
+    multiSchedParameters_.clear();
+    for ( const auto &any : tree.get_child( "parameters" ) ) {
+        multiSchedParameters_.emplace_back( any.second );
+    }
+    for ( const auto &any : tree.get_child( "statistics" ) ) {
+        statistics_.addRow( any.second.get<int>( "version" ), any.second.get<string>( "csv" ) );
+    }
+    unsigned long nRows = tree.get_child( "statistics" ).size();
+
+    // versions finished after the checkpoint was written (an incomplete last line is ignored)
+    ifstream journal( journalFile );
+    string line;
+    unsigned long nJournal = 0;
+    while ( getline( journal, line ) ) {
+        auto pos = line.find( ' ' );
+        if ( pos == string::npos || pos + 1 == line.size() || journal.eof() ) {
+            continue;
+        }
+        statistics_.addRow( stoi( line.substr( 0, pos ) ), line.substr( pos + 1 ) );
+        ++nJournal;
+    }
+    statistics_.merge();
+
+#ifdef VIESCHEDPP_LOG
+    BOOST_LOG_TRIVIAL( info ) << boost::format( "resuming multi scheduling from checkpoint at generation %d (%d "
+                                                "versions restored, %d of current generation, seed %d)" ) %
+                                     ( generation + 1 ) % ( nRows + nJournal ) % nJournal % MultiScheduling::getSeed();
+#else
+    cout << boost::format( "[info] resuming multi scheduling from checkpoint at generation %d (%d versions restored, "
+                           "%d of current generation, seed %d)\n" ) %
+                ( generation + 1 ) % ( nRows + nJournal ) % nJournal % MultiScheduling::getSeed();
+#endif
+    return true;
+}
+
+
+void VieSchedpp::runWorker( Worker &worker ) {
+    worker_ = &worker;
+    run();
+    worker_ = nullptr;
+}
+
+
 void VieSchedpp::readSkdCatalogs() {
 #ifdef VIESCHEDPP_LOG
     if ( Flags::logDebug ) BOOST_LOG_TRIVIAL( debug ) << "read skd catalogs";
@@ -468,6 +986,9 @@ void VieSchedpp::multiCoreSetup() {
     } else if ( jobSchedulingString == "guided" ) {
         omp_set_schedule( omp_sched_guided, chunkSize );
     }
+
+    // schedules are processed as tasks ordered by their cost estimate
+    costAwareScheduling_ = jobSchedulingString == "costAware";
 #endif
 }
 
@@ -576,55 +1097,22 @@ std::map<int, double> VieSchedpp::summarizeSimulationResult( const Network &netw
     for ( const auto &type : types ) {
         of << type << ":\n";
 
-        ifstream in( path_ + "statistics.csv" );
-        if ( in.is_open() ) {
-            string header;
-            getline( in, header );
-            vector<string> splitHeader;
-            boost::split( splitHeader, header, boost::is_any_of( "," ), boost::token_compress_on );
-            vector<tuple<string, int, double>> priorityLookup =
-                getPriorityCoefficients( type, network, srclist, splitHeader );
-
-            storage = map<int, vector<double>>();
-            string line;
-            while ( getline( in, line ) ) {
-                vector<double> vals;
-                vector<string> splitLine;
-                boost::split( splitLine, line, boost::is_any_of( "," ), boost::token_compress_on );
-
-                int idx;
-                try {
-                    idx = boost::lexical_cast<int>( splitLine[0] );
-                } catch ( const boost::bad_lexical_cast & ) {
-                    idx = -1;
-                }
-
-                int c = 0;
-                for ( const auto &any : priorityLookup ) {
-                    double val;
-                    try {
-                        val = boost::lexical_cast<double>( splitLine[get<1>( any )] );
-                    } catch ( const boost::bad_lexical_cast & ) {
-                        val = numeric_limits<double>::quiet_NaN();
-                    }
-                    if ( val == 9999 ) {
-                        val = numeric_limits<double>::quiet_NaN();
-                    }
-                    ++c;
-                    vals.push_back( val );
-                }
-                storage[idx] = vals;
-            }
-            map<int, double> costs = listBest( of, type, storage, priorityLookup );
-            if ( type == "mean formal errors" ) {
-                mfe_costs = move( costs );
-            } else if ( type == "repeatability" ) {
-                rep_costs = move( costs );
-            }
+        vector<tuple<string, int, double>> priorityLookup =
+            getPriorityCoefficients( type, network, srclist, statistics_.getHeader() );
+        vector<int> columns;
+        for ( const auto &any : priorityLookup ) {
+            columns.push_back( get<1>( any ) );
+        }
+        storage = statistics_.select( columns );
 
-            in.close();
-            of << endl;
+        map<int, double> costs = listBest( of, type, storage, priorityLookup );
+        if ( type == "mean formal errors" ) {
+            mfe_costs = move( costs );
+        } else if ( type == "repeatability" ) {
+            rep_costs = move( costs );
         }
+
+        of << endl;
     }
     scores = printRecommendation( mfe_costs, rep_costs, storage, output );
     return scores;
@@ -35,15 +35,23 @@
 // clang-format on
 
 #include <boost/format.hpp>
+#include <boost/property_tree/json_parser.hpp>
 #include <chrono>
 #include <cstdlib>
+#include <filesystem>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <set>
 #include <thread>
 #include <vector>
 
 #include "Initializer.h"
 #include "Misc/CalibratorBlock.h"
+#include "Misc/Coordinator.h"
 #include "Misc/HighImpactScanDescriptor.h"
+#include "Misc/Worker.h"
 #include "ObservingMode/Mode.h"
 #include "Output/Output.h"
 #include "Scheduler.h"
@@ -104,6 +112,28 @@ class VieSchedpp {
     void run();
 
 
+    /**
+     * @brief start VieSched++ as worker process
+     * @author Matthias Schartner
+     *
+     * processes the multi scheduling versions sent by the coordinator
+     *
+     * @param worker connection to coordinator
+     */
+    void runWorker( Worker &worker );
+
+
+    /**
+     * @brief set path to executable
+     * @author Matthias Schartner
+     *
+     * required to start local worker processes
+     *
+     * @param executable path to VieSched++ executable
+     */
+    void setExecutable( const std::string &executable ) { executable_ = executable; }
+
+
    private:
     std::string inputFile_;            ///< VieSchedpp.xml file
     std::string path_;                 ///< path to VieSchedpp.xml file
@@ -113,6 +143,10 @@ class VieSchedpp {
 
     SkdCatalogReader skdCatalogs_;                                          ///< sked catalogs
     std::vector<VieVS::MultiScheduling::Parameters> multiSchedParameters_;  ///< list of all multi scheduling parameters
+    bool costAwareScheduling_ = false;       ///< process schedules as tasks ordered by their cost estimate
+    StatisticsTable statistics_;             ///< statistics of all versions
+    std::string executable_ = "VieSchedpp";  ///< path to VieSched++ executable
+    Worker *worker_ = nullptr;               ///< connection to coordinator (worker process only)
 
     /**
      * @brief read sked catalogs
@@ -128,6 +162,40 @@ class VieSchedpp {
     void multiCoreSetup();
 
 
+    /**
+     * @brief write checkpoint of multi scheduling run
+     * @author Matthias Schartner
+     *
+     * The checkpoint contains all multi scheduling parameters (including the current population), the statistics of
+     * all finished versions and the seed of the random number generator.
+     * It is written to a temporary file first, so an interrupted write never corrupts the previous checkpoint.
+     *
+     * @param file checkpoint file
+     * @param generation current generation
+     * @param startCounter index of first multi scheduling parameter of current generation
+     * @param nsched number of schedules in current generation
+     */
+    void writeCheckpoint( const std::string &file, int generation, int startCounter, unsigned long nsched ) const;
+
+
+    /**
+     * @brief resume multi scheduling run from checkpoint
+     * @author Matthias Schartner
+     *
+     * Versions of the current generation which finished after the checkpoint was written are restored from the
+     * journal of the statistics table.
+     *
+     * @param file checkpoint file
+     * @param journalFile journal file
+     * @param generation current generation
+     * @param startCounter index of first multi scheduling parameter of current generation
+     * @param nsched number of schedules in current generation
+     * @return true if checkpoint was restored
+     */
+    bool readCheckpoint( const std::string &file, const std::string &journalFile, int &generation, int &startCounter,
+                         unsigned long &nsched );
+
+
     /**
      * @brief initialize log files
      * @author Matthias Schartner
@@ -138,6 +206,8 @@ class VieSchedpp {
      * @brief summarize simulation result
      * @author Matthias Schartner
      *
+     * versions are ranked based on the statistics table
+     *
      * @param output flag if output should be printed to console
      * @return score per version
      */
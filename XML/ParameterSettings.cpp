@@ -46,7 +46,8 @@ void ParameterSettings::general( const std::string &experimentName, const boost:
                                  bool useSourcesFromParameter_otherwiseIgnore, const std::vector<std::string> &srcNames,
                                  const std::vector<std::string> &satelliteNames, const std::string &scanAlignment,
                                  const std::string &logConsole, const std::string &logFile,
-                                 bool doNotObserveSourcesWithinMinRepeat, int versionOffset, bool ignore_successive_scans_same_source ) {
+                                 bool doNotObserveSourcesWithinMinRepeat, int versionOffset, bool ignore_successive_scans_same_source,
+                                 int subnettingMaxSplits ) {
     boost::property_tree::ptree general;
 
     if ( experimentName.empty() ) {
@@ -77,6 +78,9 @@ void ParameterSettings::general( const std::string &experimentName, const boost:
         } else {
             general.add( "general.subnettingMinNStaAllBut", subnettingNumber );
         }
+        if ( subnettingMaxSplits > 0 ) {
+            general.add( "general.subnettingMaxSplits", subnettingMaxSplits );
+        }
     }
 
     if ( fillinmodeAPosteriori || fillinmodeDuringScan ) {
@@ -1193,8 +1197,26 @@ void ParameterSettings::mulitsched_genetic( int maxIterations, int populationSiz
 }
 
 
+void ParameterSettings::mulitsched_genetic_earlyTermination( int interval, double tolerance ) {
+    master_.add( "VieSchedpp.multisched.genetic.early_termination.interval", interval );
+    master_.add( "VieSchedpp.multisched.genetic.early_termination.tolerance_percent", tolerance );
+}
+
+
+void ParameterSettings::mulitsched_genetic_surrogate( int candidates, double exploration, int maxSamples ) {
+    master_.add( "VieSchedpp.multisched.genetic.surrogate.candidates", candidates );
+    master_.add( "VieSchedpp.multisched.genetic.surrogate.exploration", exploration );
+    master_.add( "VieSchedpp.multisched.genetic.surrogate.max_samples", maxSamples );
+}
+
+
+void ParameterSettings::multisched_checkpoint( bool flag ) {
+    master_.add( "VieSchedpp.multisched.checkpoint", flag );
+}
+
+
 void ParameterSettings::multiCore( const string &threads, int nThreadsManual, const string &jobScheduler,
-                                   int chunkSize ) {
+                                   int chunkSize, int speculativeCandidates, int pipelineDepth ) {
     boost::property_tree::ptree mc;
     mc.add( "multiCore.threads", threads );
     if ( threads == "manual" ) {
@@ -1204,11 +1226,32 @@ void ParameterSettings::multiCore( const string &threads, int nThreadsManual, co
     if ( jobScheduler != "auto" ) {
         mc.add( "multiCore.chunkSize", chunkSize );
     }
+    if ( speculativeCandidates > 1 ) {
+        mc.add( "multiCore.speculativeCandidates", speculativeCandidates );
+    }
+    if ( pipelineDepth > 0 ) {
+        mc.add( "multiCore.pipelineDepth", pipelineDepth );
+    }
 
     master_.add_child( "VieSchedpp.multiCore", mc.get_child( "multiCore" ) );
 }
 
 
+void ParameterSettings::distributed( int port, int localWorkers, int timeout, bool remoteWorkers,
+                                     const std::string &token ) {
+    boost::property_tree::ptree dist;
+    dist.add( "distributed.port", port );
+    dist.add( "distributed.localWorkers", localWorkers );
+    dist.add( "distributed.timeout", timeout );
+    dist.add( "distributed.remoteWorkers", remoteWorkers );
+    if ( !token.empty() ) {
+        dist.add( "distributed.token", token );
+    }
+
+    master_.add_child( "VieSchedpp.multiCore.distributed", dist.get_child( "distributed" ) );
+}
+
+
 void ParameterSettings::output( const std::string &experimentDescription, const std::string &scheduler,
                                 const std::string &correlator, const std::string &notes, bool initializer,
                                 bool iteration_log, bool compress, bool createSummary, bool createNGS,
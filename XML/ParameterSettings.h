@@ -262,6 +262,7 @@ class ParameterSettings {
      * @param doNotObserveSourcesWithinMinRepeat consider scans (with reduced weight) if they are within min repeat time
      * @param versionOffset version offset
      * @param bool ignore_successive_scans_same_source should be true
+     * @param subnettingMaxSplits maximum number of station splits per subnetting source pair (0 = all)
      */
     void general( const std::string &experimentName, const boost::posix_time::ptime &startTime,
                   const boost::posix_time::ptime &endTime, bool subnetting, double subnettingAngle,
@@ -272,7 +273,7 @@ class ParameterSettings {
                   bool useSourcesFromParameter_otherwiseIgnore, const std::vector<std::string> &srcNames,
                   const std::vector<std::string> &satelliteNames, const std::string &scanAlignment,
                   const std::string &logConsole, const std::string &logFile, bool doNotObserveSourcesWithinMinRepeat,
-                  int versionOffset, bool ignore_successive_scans_same_source );
+                  int versionOffset, bool ignore_successive_scans_same_source, int subnettingMaxSplits = 0 );
 
 
     /**
@@ -647,16 +648,71 @@ class ParameterSettings {
     void mulitsched_genetic( int maxIterations, int populationSize, double selectBest, double selectRandom,
                              double mutation, double minMutation, int parents );
 
+
+    /**
+     * @brief early termination of dominated versions in genetic multisched block
+     * @author Matthias Schartner
+     *
+     * versions are compared with the best checkpoints of the previous generation, the first generation is not aborted
+     *
+     * @param interval checkpoint interval in seconds
+     * @param tolerance percentage by which a version must be worse than the previous generation to be aborted
+     */
+    void mulitsched_genetic_earlyTermination( int interval, double tolerance );
+
+
+    /**
+     * @brief surrogate model in genetic multisched block
+     * @author Matthias Schartner
+     *
+     * children are pre-selected based on a Gaussian process model of all previous results
+     *
+     * @param candidates number of candidate children per selected child
+     * @param exploration weight of prediction uncertainty (upper confidence bound)
+     * @param maxSamples maximum number of previous results used to fit the model
+     */
+    void mulitsched_genetic_surrogate( int candidates, double exploration, int maxSamples );
+
+
+    /**
+     * @brief checkpoint in multisched block
+     * @author Matthias Schartner
+     *
+     * a checkpoint is written at the start of every generation, an interrupted run is resumed from it
+     *
+     * @param flag flag if checkpoints are written
+     */
+    void multisched_checkpoint( bool flag );
+
     /**
      * @brief multiCore multi core support for scheduling
      * @author Matthias Schartner
      *
      * @param threads thread creation schema
      * @param nThreadsManual number of manually selected threads
-     * @param jobScheduler job scheduling algorithmus
+     * @param jobScheduler job scheduling algorithmus ("auto", "static", "dynamic", "guided" or "costAware")
      * @param chunkSize job scheduling chunk size
+     * @param speculativeCandidates number of best scan candidates updated in parallel (single schedules only)
+     * @param pipelineDepth maximum number of pending output and simulation tasks ("costAware" only, 0 = threads)
+     */
+    void multiCore( const std::string &threads, int nThreadsManual, const std::string &jobScheduler, int chunkSize,
+                    int speculativeCandidates = 0, int pipelineDepth = 0 );
+
+
+    /**
+     * @brief distribute multi scheduling versions to worker processes
+     * @author Matthias Schartner
+     *
+     * additional workers (e.g. on other nodes) are started with "VieSchedpp --worker host:port"
+     *
+     * @param port TCP port of coordinator (0 = any free port)
+     * @param localWorkers number of worker processes started on this machine
+     * @param timeout maximum time in seconds for one version and without any available worker (0 = no limit)
+     * @param remoteWorkers flag if workers on other machines can connect (otherwise only local connections)
+     * @param token shared token workers have to present (empty = random token)
      */
-    void multiCore( const std::string &threads, int nThreadsManual, const std::string &jobScheduler, int chunkSize );
+    void distributed( int port, int localWorkers, int timeout = 3600, bool remoteWorkers = false,
+                      const std::string &token = "" );
 
 
     /**
@@ -88,6 +88,8 @@ int main( int argc, char *argv[] ) {
         if ( arg == "--help" || arg == "-h" ) {
             std::cout << "pass path to a VieSchedpp.xml file as first input argument" << std::endl;
             std::cout << "e.g. \"./VieSchedpp path/to/VieSchedpp.xml\"" << std::endl;
+            std::cout << "pass \"--worker host:port\" to process multi scheduling versions of a coordinator"
+                      << std::endl;
             return 0;
         }
 
@@ -100,6 +102,7 @@ int main( int argc, char *argv[] ) {
         // V1: standard usage:
         std::cout << "Processing file: " << arg << "\n";
         VieVS::VieSchedpp mainScheduler( arg );
+        mainScheduler.setExecutable( argv[0] );
         mainScheduler.run();
 
         auto finish = std::chrono::high_resolution_clock::now();
@@ -118,6 +121,18 @@ int main( int argc, char *argv[] ) {
         std::string flag = argv[1];
         std::string file = argv[2];
 
+        if ( flag == "--worker" ) {
+            // multi scheduling worker process, connects to coordinator at given address
+            try {
+                VieVS::Worker worker( file );
+                VieVS::VieSchedpp mainScheduler( worker.getInputFile() );
+                mainScheduler.runWorker( worker );
+            } catch ( const std::runtime_error &e ) {
+                std::cerr << "[error] " << e.what() << std::endl;
+                return 1;
+            }
+        }
+
         if ( flag == "--snr" ) {
             VieVS::SkdParser mySkdParser( file );
             mySkdParser.read();